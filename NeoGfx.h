@@ -24,14 +24,22 @@
 
 #if ARDUINO >= 100
  #include <Arduino.h>
-#else
+#elif defined(ARDUINO)
  #include <WProgram.h>
  #include <pins_arduino.h>
+#else
+ // Outside of Arduino (e.g. a build on the host) the Adafruit_GFX.h and
+ // NeoPixelBus.h on the include path have to provide the Arduino types.
+ #include <stdint.h>
+ #include <stdlib.h>
+ #include <string.h>
 #endif
 
 #include <Adafruit_GFX.h>
 
 #include "gamma.h"
+#include "NeoGfxBands.h"
+#include "NeoGfxConvert.h"
 #ifdef __AVR__
  #include <avr/pgmspace.h>
 #elif defined(ESP8266)
@@ -40,10 +48,126 @@
  #ifndef pgm_read_byte
   #define pgm_read_byte(addr) (*(const unsigned char *)(addr))
  #endif
+ #ifndef pgm_read_word
+  #define pgm_read_word(addr) (*(const unsigned short *)(addr))
+ #endif
+ #ifndef memcpy_P
+  #define memcpy_P(dest, src, num) memcpy((dest), (src), (num))
+ #endif
+#endif
+
+// Number of recently used colors for which the converted color is kept.
+#ifndef NEOGFX_COLOR_CACHE_SIZE
+ #define NEOGFX_COLOR_CACHE_SIZE 4
+#endif
+
+// Default number of bytes for the rasterized glyphs, see enableGlyphCache.
+#ifndef NEOGFX_GLYPH_CACHE_SIZE
+ #define NEOGFX_GLYPH_CACHE_SIZE 1024
+#endif
+
+// Number of sprites which can be placed over the back buffer.
+#ifndef NEOGFX_SPRITE_COUNT
+ #define NEOGFX_SPRITE_COUNT 4
+#endif
+
+// Types of the matrix size and the pixel indices. The defaults keep the
+// footprint small. Define NEOGFX_LARGE_MATRIX before including the library
+// for matrices with more than 255 pixels in a row or column, or with
+// layouts producing indices above 65535 (e.g. for NeoPixelMultiBusGfx).
+// The remap function then returns a NeoGfxIndex (remap functions
+// returning uint16_t are still accepted) and tables passed to
+// setRemapTable_P hold NeoGfxIndex entries. Note that a single
+// NeoPixelBus is limited to 65535 pixels.
+#ifdef NEOGFX_LARGE_MATRIX
+ typedef uint16_t NeoGfxDim;
+ typedef uint32_t NeoGfxIndex;
+#else
+ typedef uint8_t  NeoGfxDim;
+ typedef uint16_t NeoGfxIndex;
+#endif
+
+// Counters for profiling, only collected if NEOGFX_STATS is defined before
+// including the library. Without it the counting compiles to nothing.
+struct NeoGfxStats {
+    uint32_t drawPixelCalls;   // calls of drawPixel
+    uint32_t clippedPixels;    // pixels drawn outside of the matrix
+    uint32_t remapCalls;       // x/y to index mappings (not counting the remap table)
+    uint32_t colorConversions; // 565 colors expanded (not counting cache hits)
+    uint32_t spanWrites;       // runs of pixels written at once
+    uint32_t drawMicros;       // time spent in drawing
+    uint32_t showMicros;       // time spent in Show()
+    uint32_t frames;           // calls of Show()
+};
+
+// Flags of a frame stream packet, see NeoGfx::feedStream.
+enum NeoGfxStreamFlags {
+    NeoGfxStreamRemap      = 0x01, // offset and pixels are y * width + x of the unrotated matrix
+    NeoGfxStreamWireOrder  = 0x02, // the bytes are in the order of the feature and are copied as they are
+    NeoGfxStreamEndOfFrame = 0x04  // feedStream returns true after the packet
+};
+
+// Statistics of the frames run by NeoGfx::update().
+struct NeoGfxFrameStats {
+    uint32_t frames;          // rendered frames
+    uint32_t skipped;         // frames dropped because the bus was busy or rendering was late
+    uint16_t fps;             // frames rendered within the last full second
+    uint32_t jitterMicros;    // average deviation of the frame interval from the target
+    uint32_t maxJitterMicros; // largest deviation of the frame interval from the target
+};
+
+// Current of a pixel for the power estimate (in uA), see
+// NeoGfx::enablePowerEstimate. The defaults are the usual figures of
+// WS2812 and SK6812 LEDs.
+struct NeoGfxPowerModel {
+    uint16_t red;   // a fully lit red channel
+    uint16_t green;
+    uint16_t blue;
+    uint16_t white;
+    uint16_t idle;  // a dark pixel
+
+    NeoGfxPowerModel(uint16_t r = 20000, uint16_t g = 20000, uint16_t b = 20000, uint16_t w = 20000, uint16_t i = 1000) :
+      red(r), green(g), blue(b), white(w), idle(i)
+    {
+    }
+};
+
+#ifdef NEOGFX_STATS
+ #define NEOGFX_COUNT(counter, n) (stats.counter += (n))
+ #define NEOGFX_DRAW_SCOPE DrawScope drawScope(this)
+#else
+ #define NEOGFX_COUNT(counter, n)
+ #define NEOGFX_DRAW_SCOPE
 #endif
 
+// Default layout: pixels are mapped at runtime by the function passed to
+// setRemapFunction (or the table passed to setRemapTable_P).
+class NeoGfxRemapLayout {
+};
+
+// Layout for matrices built from equal tiles, the compile time version of
+// NeoTiles. The number of tiles follows from the size of the whole matrix.
+// T_MATRIX_LAYOUT is the layout of the pixels within a tile,
+// T_TILE_LAYOUT the layout of the tiles.
+template<typename T_MATRIX_LAYOUT, typename T_TILE_LAYOUT, uint16_t TILE_WIDTH, uint16_t TILE_HEIGHT>
+class NeoGfxTilesLayout {
+
+ public:
+    static NeoGfxIndex Map(uint16_t width, uint16_t height, uint16_t x, uint16_t y) {
+      NeoGfxIndex localIndex = T_MATRIX_LAYOUT::Map(TILE_WIDTH, TILE_HEIGHT, x % TILE_WIDTH, y % TILE_HEIGHT);
+      NeoGfxIndex tileIndex  = T_TILE_LAYOUT::Map(width / TILE_WIDTH, height / TILE_HEIGHT, x / TILE_WIDTH, y / TILE_HEIGHT);
+
+      return localIndex + tileIndex * (NeoGfxIndex)(TILE_WIDTH * TILE_HEIGHT);
+    }
+};
+
 // T_NEO_PIXEL_BUS should be the specific NeoPixelBus class. (e.g. NeoPixelBus or NeoPixelBrightnessBus)
-template<typename T_COLOR_FEATURE, typename T_METHOD, typename T_NEO_PIXEL_BUS>
+// T_LAYOUT may be a NeoPixelBus layout (e.g. ColumnMajorAlternating180Layout),
+// a NeoGfxTilesLayout or any class with a static
+// uint16_t Map(uint16_t width, uint16_t height, uint16_t x, uint16_t y).
+// The mapping then gets inlined and the remap function is not used.
+// T_GAMMA selects the gamma tables, e.g. NeoGfxGamma<220> (see gamma.h).
+template<typename T_COLOR_FEATURE, typename T_METHOD, typename T_NEO_PIXEL_BUS, typename T_LAYOUT = NeoGfxRemapLayout, typename T_GAMMA = NeoGfxDefaultGamma>
 class NeoGfx {
 
  public:
@@ -52,50 +176,775 @@ class NeoGfx {
     // NOTE:  Pin Number maybe ignored due to hardware limitations of the method.
     
     NeoGfx(int w, int h, NeoPixelBus<T_COLOR_FEATURE, T_METHOD>* neoPixelBusInstance) :
-      matrixWidth(w), matrixHeight(h), remapFn(NULL), neoPixelBus(neoPixelBusInstance)
+      matrixWidth(w), matrixHeight(h), remapFn(NULL), remapTable_P(NULL), neoPixelBus(neoPixelBusInstance)
     {
+#ifndef NEOGFX_NO_BULK_CONVERT
+      neoGfxProbeWireFormat<T_COLOR_FEATURE>(wireFormat);
+#endif
+      resetColorCache();
+    }
+
+    // The number of pixels of the bus of a w x h matrix, or 0 if the matrix
+    // doesn't fit: a NeoPixelBus counts its pixels in 16 bits and without
+    // NEOGFX_LARGE_MATRIX the width and height are limited to 255. A matrix
+    // without pixels draws nothing, instead of drawing to a truncated one.
+    static uint16_t busPixels(int w, int h) {
+      if(w <= 0 || h <= 0 || w > (NeoGfxDim) ~0 || h > (NeoGfxDim) ~0) return 0;
+      uint32_t pixels = (uint32_t)w * h;
+      return pixels <= 0xFFFF ? pixels : 0;
+    }
+
+    ~NeoGfx() {
+      if(!sharedBuffers) {
+        freeRemapTable();
+        freeColorTable();
+        freeBackBuffer();
+        freeIndexedColor();
+      }
+      freeGlyphCache();
+    }
+
+    // The tables and buffers are owned (see the destructor), copies would
+    // free them twice.
+    NeoGfx(const NeoGfx&) = delete;
+    NeoGfx& operator=(const NeoGfx&) = delete;
+
+    // Makes this NeoGfx draw into the pixels of canvas (on the same bus),
+    // with its remapping, color conversion (including pass-through and the
+    // native text colors), back buffer and power model. The tables and
+    // buffers are only borrowed, canvas has to keep them while this one
+    // draws. Used for the bands of renderBands, which each need their own
+    // color cache and dirty rect.
+    void shareBuffers(const NeoGfx& canvas) {
+      remapFn         = canvas.remapFn;
+#ifdef NEOGFX_LARGE_MATRIX
+      remapFn16       = canvas.remapFn16;
+#endif
+      remapTable_P    = canvas.remapTable_P;
+      remapTable      = canvas.remapTable;
+      currentRotation = canvas.currentRotation;
+      backBuffer      = canvas.backBuffer;
+      outputTable     = canvas.outputTable;
+      indexBuffer     = canvas.indexBuffer;
+      indexBits       = canvas.indexBits;
+      palette         = canvas.palette;
+      passThruColor   = canvas.passThruColor;
+      passThruFlag    = canvas.passThruFlag;
+      nativeTextFg    = canvas.nativeTextFg;
+      nativeTextBg    = canvas.nativeTextBg;
+      nativeTextFlag  = canvas.nativeTextFlag;
+      powerTracking   = canvas.powerTracking;
+      powerModel      = canvas.powerModel;
+      memcpy(powerChannel, canvas.powerChannel, sizeof(powerChannel));
+      memcpy(powerBlack, canvas.powerBlack, sizeof(powerBlack));
+      memcpy(powerRange, canvas.powerRange, sizeof(powerRange));
+      memset(powerSums, 0, sizeof(powerSums));
+      resetColorCache();
+      colorTable      = canvas.colorTable;
+      sharedBuffers   = true;
+    }
+
+    // Restricts all drawing to a rect (in the coordinates of the current
+    // rotation), in addition to the clipping at the border of the matrix.
+    void setClipRect(int16_t x, int16_t y, int16_t w, int16_t h) {
+      clipX0 = x;
+      clipY0 = y;
+      clipX1 = x + w;
+      clipY1 = y + h;
+    }
+
+    void clearClipRect() {
+      setClipRect(0, 0, 0x7FFF, 0x7FFF);
+    }
+
+    // Shows the pixels of the bus. Without a back buffer this is the
+    // current frame, so it is not dirty anymore.
+    void show(bool maintainBufferConsistency = true) {
+      if(!backBuffer) resetDirty();
+      if(indexBuffer) {
+        expandIndices((T_NEO_PIXEL_BUS*) neoPixelBus);
+        recountPower();
+      }
+
+#ifdef NEOGFX_STATS
+      unsigned long start = micros();
+      neoPixelBus->Show(maintainBufferConsistency);
+      stats.showMicros += micros() - start;
+      stats.frames++;
+
+      if(frameCallback) (*frameCallback)(stats);
+#else
+      neoPixelBus->Show(maintainBufferConsistency);
+#endif
+    }
+
+#ifdef NEOGFX_STATS
+    const NeoGfxStats& getStats() const {
+      return stats;
+    }
+
+    void resetStats() {
+      memset(&stats, 0, sizeof(stats));
+    }
+
+    // The callback is called after every Show() with the stats collected
+    // so far, e.g. to log them and call resetStats() for per frame values.
+    void setFrameCallback(void (*fn)(const NeoGfxStats& stats)) {
+      frameCallback = fn;
+    }
+
+    // Drawing time is measured from the outermost beginDraw to its endDraw
+    // (Adafruit_GFX's startWrite / endWrite).
+    void beginDraw() {
+      if(drawDepth++ == 0) drawStart = micros();
+    }
+
+    void endDraw() {
+      if(drawDepth > 0 && --drawDepth == 0) stats.drawMicros += micros() - drawStart;
+    }
+#endif
+
+    // Frame pacing: update() has to be called from loop() as often as
+    // possible. When the next frame is due and the bus is ready it calls the
+    // render callback with the time since the last frame and shows the
+    // frame if something changed. Otherwise it returns at once (after a
+    // yield()), so loop() can do other work in between. A frame which is due
+    // while the bus is still busy is rendered as soon as it is ready, frames
+    // missed completely are dropped instead of rendered late.
+    void setFrameRate(uint16_t fps) {
+      frameInterval = fps ? 1000000UL / fps : 0;
+      nextFrame = micros();
+    }
+
+    // deltaMicros is 0 for the first frame.
+    void setRenderCallback(void (*fn)(uint32_t deltaMicros)) {
+      renderFn = fn;
+      frameStarted = false;
+    }
+
+    // Returns true if a frame was rendered.
+    bool update() {
+      uint32_t now = micros();
+      if(!renderFn || (int32_t)(now - nextFrame) < 0 || !neoPixelBus->CanShow()) {
+        yield();
+        return false;
+      }
+
+      // the first frame is on time, however long ago the rate was set
+      if(!frameStarted) nextFrame = now;
+
+      uint32_t late = now - nextFrame;
+      if(frameInterval && late >= frameInterval) {
+        uint32_t missed = late / frameInterval;
+        frameStats.skipped += missed;
+        nextFrame += missed * frameInterval;
+      }
+      nextFrame += frameInterval;
+
+      uint32_t delta = 0;
+      if(frameStarted) {
+        delta = now - lastFrame;
+
+        uint32_t jitter = delta > frameInterval ? delta - frameInterval : frameInterval - delta;
+        frameStats.jitterMicros = frameStats.jitterMicros - frameStats.jitterMicros / 16 + jitter / 16;
+        if(jitter > frameStats.maxJitterMicros) frameStats.maxJitterMicros = jitter;
+      } else {
+        frameStarted = true;
+        fpsStart = now;
+        fpsFrames = 0;
+      }
+      lastFrame = now;
+
+      (*renderFn)(delta);
+      showIfDirty();
+
+      // the frames of the second before this one
+      frameStats.frames++;
+      if(now - fpsStart >= 1000000UL) {
+        frameStats.fps = fpsFrames;
+        fpsStart = now;
+        fpsFrames = 0;
+      }
+      fpsFrames++;
+      return true;
+    }
+
+    const NeoGfxFrameStats& getFrameStats() const {
+      return frameStats;
+    }
+
+    void resetFrameStats() {
+      memset(&frameStats, 0, sizeof(frameStats));
+    }
+
+    // Band rendering: the canvas (in the current rotation) is split into
+    // bands of rows and fn is called once per band, in parallel on the
+    // cores of an ESP32 or the host (see NeoGfxBands.h). Each call gets an
+    // Adafruit_GFX clipped to the rows y to y + h - 1, so fn may draw the
+    // whole scene, but skipping what is outside of the band saves time.
+    // The bands write disjoint pixels of the bus (or the back buffer); show
+    // the frame afterwards with show(), showIfDirty() or present().
+    // Within fn the 565 colors go through the conversion of this NeoGfx,
+    // so a pass-through color applies, and text uses the native text
+    // colors if there are any. The glyph cache is not used.
+    // The bands write the pixels of the bus directly and the dirty flag of
+    // the bus is set once they are all done. Buses which change the colors
+    // on SetPixelColor (e.g. NeoPixelBrightnessBus) without a back buffer
+    // and 4-bit indices (which share bytes between bands) are rendered one
+    // band after the other.
+    void renderBands(void (*fn)(Adafruit_GFX& gfx, int16_t y, int16_t h), uint8_t bands, uint16_t _height, uint8_t rotation) {
+      NEOGFX_DRAW_SCOPE;
+
+      if(bands > NEOGFX_MAX_BANDS) bands = NEOGFX_MAX_BANDS;
+      if(bands > _height) bands = _height;
+      if(bands == 0) return;
+
+      Band band[NEOGFX_MAX_BANDS];
+      for(uint8_t i=0; i<bands; i++) {
+        band[i].canvas   = this;
+        band[i].fn       = fn;
+        band[i].rotation = rotation;
+        band[i].y        = (int32_t)_height * i / bands;
+        band[i].h        = (int32_t)_height * (i + 1) / bands - band[i].y;
+        band[i].dirty    = false;
+      }
+
+      if(indexBits == 4 || !writesWire((T_NEO_PIXEL_BUS*) neoPixelBus)) {
+        for(uint8_t i=0; i<bands; i++) {
+          renderBand(band, i);
+        }
+      } else {
+        neoGfxParallelFor(bands, &renderBand, band);
+      }
+
+      for(uint8_t i=0; i<bands; i++) {
+        if(band[i].dirty) {
+          markDirty(band[i].dirtyX, band[i].dirtyY, band[i].dirtyW, band[i].dirtyH);
+          if(!backBuffer) neoPixelBus->Dirty();
+        }
+        if(powerTracking) {
+          for(uint8_t k=0; k<T_COLOR_FEATURE::PixelSize; k++) {
+            powerSums[k] += band[i].power[k];
+          }
+        }
+      }
     }
 
     void drawPixel(int16_t x, int16_t y, uint16_t color, uint16_t _width, uint16_t _height,  uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
-      if((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return;
+      drawPixel(x, y, convertColor(color), _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    // The drawing functions taking a color of the feature (e.g. RgbwColor)
+    // write it as it is, without any conversion or gamma correction.
+    void drawPixel(int16_t x, int16_t y, typename T_COLOR_FEATURE::ColorObject c, uint16_t _width, uint16_t _height,  uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      NEOGFX_DRAW_SCOPE;
+      NEOGFX_COUNT(drawPixelCalls, 1);
+
+      if(glyphCapture) {
+        captureRect(x, y, 1, 1);
+        return;
+      }
+      if((x < clipX0) || (y < clipY0) || (x >= _width) || (y >= _height) || (x >= clipX1) || (y >= clipY1)) {
+        NEOGFX_COUNT(clippedPixels, 1);
+        return;
+      }
+
+      if(setPixel(pixelIndex(x, y, _width, rotation, WIDTH, HEIGHT), c)) {
+        markDirty(x, y, 1, 1);
+      }
+    }
+
+    void fillScreen(uint16_t color) {
+      fillScreen(convertColor(color));
+    }
+
+    void fillScreen(typename T_COLOR_FEATURE::ColorObject c) {
+      NEOGFX_DRAW_SCOPE;
+
+      if(writeRun(0, neoPixelBus->PixelCount() - 1, c)) {
+        markDirty();
+      }
+    }
+
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color, uint16_t _width, uint16_t _height,  uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      fillRect(x, y, w, 1, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, typename T_COLOR_FEATURE::ColorObject color, uint16_t _width, uint16_t _height,  uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      fillRect(x, y, w, 1, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color, uint16_t _width, uint16_t _height,  uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      fillRect(x, y, 1, h, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void writeFastVLine(int16_t x, int16_t y, int16_t h, typename T_COLOR_FEATURE::ColorObject color, uint16_t _width, uint16_t _height,  uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      fillRect(x, y, 1, h, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint16_t _width, uint16_t _height,  uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      fillRect(x, y, w, h, convertColor(color), _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    // Clips the rect once and then writes the covered pixels row by row.
+    // Pixels which end up next to each other on the bus (e.g. a row of a
+    // serpentine layout) are written as one run.
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, typename T_COLOR_FEATURE::ColorObject c, uint16_t _width, uint16_t _height,  uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      NEOGFX_DRAW_SCOPE;
+
+      if(w < 0) { x += w + 1; w = -w; }
+      if(h < 0) { y += h + 1; h = -h; }
+      if(glyphCapture) {
+        captureRect(x, y, w, h);
+        return;
+      }
+#ifdef NEOGFX_STATS
+      int32_t area = (int32_t)w * h;
+#endif
+
+      if(x < clipX0) { w += x - clipX0; x = clipX0; }
+      if(y < clipY0) { h += y - clipY0; y = clipY0; }
+      if(x + w > (int16_t)_width)  w = _width  - x;
+      if(y + h > (int16_t)_height) h = _height - y;
+      if(x + w > clipX1) w = clipX1 - x;
+      if(y + h > clipY1) h = clipY1 - y;
+      if((w <= 0) || (h <= 0)) {
+        NEOGFX_COUNT(clippedPixels, area);
+        return;
+      }
+      NEOGFX_COUNT(clippedPixels, area - (int32_t)w * h);
+
+      bool changed = false;
 
+      if(remapTable && rotation == currentRotation) {
+        for(int16_t row = y; row < y + h; row++) {
+          changed |= writeIndices(&remapTable[(NeoGfxIndex)row * _width + x], w, c);
+        }
+        if(changed) markDirty(x, y, w, h);
+        return;
+      }
+
+      int16_t dirtyX = x, dirtyY = y, dirtyW = w, dirtyH = h;
+
+      // rotate the clipped rect into the unrotated (raw) coordinate space
       int16_t t;
       switch(rotation) {
       case 1:
         t = x;
-        x = WIDTH  - 1 - y;
+        x = WIDTH - y - h;
         y = t;
+        t = w; w = h; h = t;
         break;
       case 2:
-        x = WIDTH  - 1 - x;
-        y = HEIGHT - 1 - y;
+        x = WIDTH  - x - w;
+        y = HEIGHT - y - h;
         break;
       case 3:
         t = x;
         x = y;
-        y = HEIGHT - 1 - t;
+        y = HEIGHT - t - w;
+        t = w; w = h; h = t;
         break;
       }
 
-      int tileOffset = 0;
-      int pixelOffset = 0;
+      if(fillRawRect(x, y, w, h, c)) {
+        markDirty(dirtyX, dirtyY, dirtyW, dirtyH);
+      }
+    }
+
+    // Moves the content by dx/dy (in the coordinates of the current
+    // rotation) by copying the pixel values, the uncovered part is filled
+    // with color. The pixels are walked against the direction of the move,
+    // so every pixel is read before it gets overwritten.
+    void scroll(int16_t dx, int16_t dy, uint16_t color, uint16_t _width, uint16_t _height,  uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      scroll(dx, dy, convertColor(color), _width, _height, rotation, WIDTH, HEIGHT);
+    }
 
-      if(remapFn) { // Custom X/Y remapping function
-        pixelOffset = (*remapFn)(x, y);
+    void scroll(int16_t dx, int16_t dy, typename T_COLOR_FEATURE::ColorObject color, uint16_t _width, uint16_t _height,  uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      NEOGFX_DRAW_SCOPE;
+
+      if(dx == 0 && dy == 0) return;
+      if(abs(dx) >= (int16_t)_width || abs(dy) >= (int16_t)_height) {
+        fillRect(0, 0, _width, _height, color, _width, _height, rotation, WIDTH, HEIGHT);
+        return;
+      }
+
+      int16_t w = _width  - abs(dx);
+      int16_t h = _height - abs(dy);
+      int16_t x0 = dx > 0 ? dx : 0;
+      int16_t y0 = dy > 0 ? dy : 0;
+      int16_t rows = abs(dy) + 1;
+
+      // The rows are moved in an order which reads every row before it is
+      // overwritten, row k of that order is read by row k - |dy|. Their
+      // indices are mapped once into a ring of |dy| + 1 rows, or taken
+      // from the remap table.
+      bool useTable = remapTable && rotation == currentRotation;
+      NeoGfxIndex* ring = NULL;
+      if(!useTable) {
+        ring = (NeoGfxIndex*) malloc(sizeof(NeoGfxIndex) * rows * _width);
+        if(!ring) {
+          scrollPixels(dx, dy, _width, _height, rotation, WIDTH, HEIGHT);
+        }
       }
-      
-      ((T_NEO_PIXEL_BUS*) neoPixelBus)->SetPixelColor(tileOffset + pixelOffset, 
-        passThruFlag ? passThruColor  : RgbColor(HtmlColor(expandColor(color))));
+
+      if(useTable || ring) {
+        for(int16_t k = 0; ring && k < rows - 1; k++) {
+          mapScrollRow(ring, k, dy, rows, _width, _height, rotation, WIDTH, HEIGHT);
+        }
+        for(int16_t j = 0; j < h; j++) {
+          int16_t y = dy > 0 ? _height - 1 - j : j;
+          const NeoGfxIndex* from = useTable ? &remapTable[(NeoGfxIndex)(y - dy) * _width] : mapScrollRow(ring, j + rows - 1, dy, rows, _width, _height, rotation, WIDTH, HEIGHT);
+          const NeoGfxIndex* to   = useTable ? &remapTable[(NeoGfxIndex)y * _width] : &ring[(j % rows) * _width];
+          scrollRow(to, from, dx, x0, w);
+        }
+        free(ring);
+      }
+      if(!backBuffer) neoPixelBus->Dirty();
+      markDirty(x0, y0, w, h);
+
+      // the uncovered columns, and the uncovered rows without them
+      if(dx != 0) fillRect(dx > 0 ? 0 : w, 0, abs(dx), _height, color, _width, _height, rotation, WIDTH, HEIGHT);
+      if(dy != 0) fillRect(x0, dy > 0 ? 0 : h, w, abs(dy), color, _width, _height, rotation, WIDTH, HEIGHT);
     }
 
-    void fillScreen(uint16_t color) {
-      uint16_t i, n;
-      typename T_COLOR_FEATURE::ColorObject c;
+    // The Adafruit_GFX primitives for colors of the feature, with the same
+    // algorithms, so they cover the same pixels as with a 16-bit color.
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, typename T_COLOR_FEATURE::ColorObject color, uint16_t _width, uint16_t _height,  uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      NEOGFX_DRAW_SCOPE;
+
+      if(x0 == x1) {
+        if(y0 > y1) swapCoordinates(y0, y1);
+        fillRect(x0, y0, 1, y1 - y0 + 1, color, _width, _height, rotation, WIDTH, HEIGHT);
+        return;
+      }
+      if(y0 == y1) {
+        if(x0 > x1) swapCoordinates(x0, x1);
+        fillRect(x0, y0, x1 - x0 + 1, 1, color, _width, _height, rotation, WIDTH, HEIGHT);
+        return;
+      }
+
+      bool steep = abs(y1 - y0) > abs(x1 - x0);
+      if(steep) {
+        swapCoordinates(x0, y0);
+        swapCoordinates(x1, y1);
+      }
+      if(x0 > x1) {
+        swapCoordinates(x0, x1);
+        swapCoordinates(y0, y1);
+      }
+
+      int16_t dx = x1 - x0;
+      int16_t dy = abs(y1 - y0);
+      int16_t err = dx / 2;
+      int16_t ystep = y0 < y1 ? 1 : -1;
+
+      for(; x0 <= x1; x0++) {
+        if(steep) {
+          drawPixel(y0, x0, color, _width, _height, rotation, WIDTH, HEIGHT);
+        } else {
+          drawPixel(x0, y0, color, _width, _height, rotation, WIDTH, HEIGHT);
+        }
+        err -= dy;
+        if(err < 0) {
+          y0 += ystep;
+          err += dx;
+        }
+      }
+    }
+
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, typename T_COLOR_FEATURE::ColorObject color, uint16_t _width, uint16_t _height,  uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      NEOGFX_DRAW_SCOPE;
+
+      fillRect(x, y, w, 1, color, _width, _height, rotation, WIDTH, HEIGHT);
+      fillRect(x, y + h - 1, w, 1, color, _width, _height, rotation, WIDTH, HEIGHT);
+      fillRect(x, y, 1, h, color, _width, _height, rotation, WIDTH, HEIGHT);
+      fillRect(x + w - 1, y, 1, h, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void drawCircle(int16_t x0, int16_t y0, int16_t r, typename T_COLOR_FEATURE::ColorObject color, uint16_t _width, uint16_t _height,  uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      NEOGFX_DRAW_SCOPE;
+
+      int16_t f = 1 - r;
+      int16_t ddF_x = 1;
+      int16_t ddF_y = -2 * r;
+      int16_t x = 0;
+      int16_t y = r;
+
+      drawPixel(x0, y0 + r, color, _width, _height, rotation, WIDTH, HEIGHT);
+      drawPixel(x0, y0 - r, color, _width, _height, rotation, WIDTH, HEIGHT);
+      drawPixel(x0 + r, y0, color, _width, _height, rotation, WIDTH, HEIGHT);
+      drawPixel(x0 - r, y0, color, _width, _height, rotation, WIDTH, HEIGHT);
+
+      while(x < y) {
+        if(f >= 0) {
+          y--;
+          ddF_y += 2;
+          f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+
+        drawPixel(x0 + x, y0 + y, color, _width, _height, rotation, WIDTH, HEIGHT);
+        drawPixel(x0 - x, y0 + y, color, _width, _height, rotation, WIDTH, HEIGHT);
+        drawPixel(x0 + x, y0 - y, color, _width, _height, rotation, WIDTH, HEIGHT);
+        drawPixel(x0 - x, y0 - y, color, _width, _height, rotation, WIDTH, HEIGHT);
+        drawPixel(x0 + y, y0 + x, color, _width, _height, rotation, WIDTH, HEIGHT);
+        drawPixel(x0 - y, y0 + x, color, _width, _height, rotation, WIDTH, HEIGHT);
+        drawPixel(x0 + y, y0 - x, color, _width, _height, rotation, WIDTH, HEIGHT);
+        drawPixel(x0 - y, y0 - x, color, _width, _height, rotation, WIDTH, HEIGHT);
+      }
+    }
+
+    // The columns of the circle, each one span.
+    void fillCircle(int16_t x0, int16_t y0, int16_t r, typename T_COLOR_FEATURE::ColorObject color, uint16_t _width, uint16_t _height,  uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      NEOGFX_DRAW_SCOPE;
+
+      fillRect(x0, y0 - r, 1, 2 * r + 1, color, _width, _height, rotation, WIDTH, HEIGHT);
+
+      int16_t f = 1 - r;
+      int16_t ddF_x = 1;
+      int16_t ddF_y = -2 * r;
+      int16_t x = 0;
+      int16_t y = r;
+      int16_t px = x;
+      int16_t py = y;
+
+      while(x < y) {
+        if(f >= 0) {
+          y--;
+          ddF_y += 2;
+          f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+
+        if(x < y + 1) {
+          fillRect(x0 + x, y0 - y, 1, 2 * y + 1, color, _width, _height, rotation, WIDTH, HEIGHT);
+          fillRect(x0 - x, y0 - y, 1, 2 * y + 1, color, _width, _height, rotation, WIDTH, HEIGHT);
+        }
+        if(y != py) {
+          fillRect(x0 + py, y0 - px, 1, 2 * px + 1, color, _width, _height, rotation, WIDTH, HEIGHT);
+          fillRect(x0 - py, y0 - px, 1, 2 * px + 1, color, _width, _height, rotation, WIDTH, HEIGHT);
+          py = y;
+        }
+        px = x;
+      }
+    }
+
+    // Bitmaps are clipped once and then written row by row straight to the
+    // pixel indices. const bitmaps are read from PROGMEM, non-const ones
+    // from RAM (like in Adafruit_GFX).
+
+    // 1-bit bitmap, only set bits are drawn (transparent) if bg is NULL.
+    void drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, bool inProgmem, int16_t w, int16_t h, uint16_t color, const uint16_t* bg, uint16_t _width, uint16_t _height,  uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      typename T_COLOR_FEATURE::ColorObject fg = convertColor(color);
+      typename T_COLOR_FEATURE::ColorObject back = bg ? convertColor(*bg) : fg;
+      drawBitmap(x, y, bitmap, inProgmem, w, h, fg, bg ? &back : NULL, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, bool inProgmem, int16_t w, int16_t h, typename T_COLOR_FEATURE::ColorObject fg, const typename T_COLOR_FEATURE::ColorObject* bg, uint16_t _width, uint16_t _height,  uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      NEOGFX_DRAW_SCOPE;
+
+      int16_t i0, j0, i1, j1;
+      if(!clipBitmap(x, y, w, h, i0, j0, i1, j1, _width, _height)) return;
+
+      typename T_COLOR_FEATURE::ColorObject back = bg ? *bg : fg;
+
+      int16_t byteWidth = (w + 7) / 8;
+      for(int16_t j=j0; j<j1; j++) {
+        const uint8_t* row = &bitmap[j * byteWidth];
+        for(int16_t i=i0; i<i1; i++) {
+          uint8_t b = inProgmem ? pgm_read_byte(&row[i / 8]) : row[i / 8];
+          bool set = b & (0x80 >> (i & 7));
+          if(set || bg) {
+            if(setPixel(pixelIndex(x + i, y + j, _width, rotation, WIDTH, HEIGHT), set ? fg : back)) {
+              markDirty(x + i, y + j, 1, 1);
+            }
+          }
+        }
+      }
+    }
+
+    // 8-bit bitmap. Like Adafruit_GFX the value is used as 16-bit color.
+    void drawGrayscaleBitmap(int16_t x, int16_t y, const uint8_t* bitmap, bool inProgmem, int16_t w, int16_t h, uint16_t _width, uint16_t _height,  uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      NEOGFX_DRAW_SCOPE;
+
+      int16_t i0, j0, i1, j1;
+      if(!clipBitmap(x, y, w, h, i0, j0, i1, j1, _width, _height)) return;
+
+      for(int16_t j=j0; j<j1; j++) {
+        const uint8_t* row = &bitmap[j * w];
+        for(int16_t i=i0; i<i1; i++) {
+          uint8_t gray = inProgmem ? pgm_read_byte(&row[i]) : row[i];
+          if(setPixel(pixelIndex(x + i, y + j, _width, rotation, WIDTH, HEIGHT), convertColor(gray))) {
+            markDirty(x + i, y + j, 1, 1);
+          }
+        }
+      }
+    }
+
+    // 16-bit (565) bitmap.
+    void drawRGBBitmap(int16_t x, int16_t y, const uint16_t* bitmap, bool inProgmem, int16_t w, int16_t h, uint16_t _width, uint16_t _height,  uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      NEOGFX_DRAW_SCOPE;
+
+      int16_t i0, j0, i1, j1;
+      if(!clipBitmap(x, y, w, h, i0, j0, i1, j1, _width, _height)) return;
+
+#ifndef NEOGFX_NO_BULK_CONVERT
+      if(canConvertInBulk()) {
+        drawRGBBitmapInBulk(x, y, bitmap, inProgmem, w, i0, j0, i1, j1, _width, rotation, WIDTH, HEIGHT);
+        return;
+      }
+#endif
+
+      for(int16_t j=j0; j<j1; j++) {
+        const uint16_t* row = &bitmap[j * w];
+        for(int16_t i=i0; i<i1; i++) {
+          uint16_t color = inProgmem ? pgm_read_word(&row[i]) : row[i];
+          if(setPixel(pixelIndex(x + i, y + j, _width, rotation, WIDTH, HEIGHT), convertColor(color))) {
+            markDirty(x + i, y + j, 1, 1);
+          }
+        }
+      }
+    }
+
+    // 24-bit bitmap with 3 bytes (r, g, b) per pixel. The colors are used
+    // as they are, there is no gamma correction. Draws nothing with indexed
+    // colors.
+    void drawRGB24Bitmap(int16_t x, int16_t y, const uint8_t* bitmap, bool inProgmem, int16_t w, int16_t h, uint16_t _width, uint16_t _height,  uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      if(indexBuffer) return;
+      NEOGFX_DRAW_SCOPE;
+
+      int16_t i0, j0, i1, j1;
+      if(!clipBitmap(x, y, w, h, i0, j0, i1, j1, _width, _height)) return;
+
+      for(int16_t j=j0; j<j1; j++) {
+        const uint8_t* rgb = &bitmap[(j * w + i0) * 3];
+        for(int16_t i=i0; i<i1; i++, rgb += 3) {
+          typename T_COLOR_FEATURE::ColorObject c = inProgmem ?
+            RgbColor(pgm_read_byte(&rgb[0]), pgm_read_byte(&rgb[1]), pgm_read_byte(&rgb[2])) :
+            RgbColor(rgb[0], rgb[1], rgb[2]);
+          if(setPixel(pixelIndex(x + i, y + j, _width, rotation, WIDTH, HEIGHT), c)) {
+            markDirty(x + i, y + j, 1, 1);
+          }
+        }
+      }
+    }
+
+    // Bitmap of colors of the feature (e.g. RgbwColor), copied without any
+    // conversion or gamma correction. Draws nothing with indexed colors.
+    void drawNativeBitmap(int16_t x, int16_t y, const typename T_COLOR_FEATURE::ColorObject* bitmap, bool inProgmem, int16_t w, int16_t h, uint16_t _width, uint16_t _height,  uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      if(indexBuffer) return;
+      NEOGFX_DRAW_SCOPE;
+
+      int16_t i0, j0, i1, j1;
+      if(!clipBitmap(x, y, w, h, i0, j0, i1, j1, _width, _height)) return;
+
+      for(int16_t j=j0; j<j1; j++) {
+        const typename T_COLOR_FEATURE::ColorObject* row = &bitmap[j * w];
+        for(int16_t i=i0; i<i1; i++) {
+          typename T_COLOR_FEATURE::ColorObject c;
+          if(inProgmem) {
+            memcpy_P(&c, &row[i], sizeof(c));
+          } else {
+            c = row[i];
+          }
+          if(setPixel(pixelIndex(x + i, y + j, _width, rotation, WIDTH, HEIGHT), c)) {
+            markDirty(x + i, y + j, 1, 1);
+          }
+        }
+      }
+    }
+
+    // Frame streams carry pixels (e.g. from a host over serial) in packets:
+    //   'N' 'G' flags channels offset count pixels
+    // with offset and count as 16-bit little endian pixel numbers and
+    // channels (2 for a 565 color, little endian, 3 for r, g, b or 4 for
+    // r, g, b, w) bytes per pixel.
+    // Without NeoGfxStreamRemap offset is the index on the bus. The pixels
+    // are written straight to the pixels of the bus (or the back buffer)
+    // while the chunks are fed, so packets can be split at any byte.
+    // Invalid headers are skipped until the next 'N' 'G'.
+    // Returns true if a packet with NeoGfxStreamEndOfFrame was completed.
+    bool feedStream(const uint8_t* data, size_t length) {
+      bool endOfFrame = false;
 
-      c = passThruFlag ? passThruColor : RgbColor(HtmlColor(expandColor(color)));
-      n = neoPixelBus->PixelCount();
+      while(length) {
+        if(streamHeaderLength < StreamHeaderSize) {
+          uint8_t b = *data++;
+          length--;
 
-      for(i=0; i<n; i++) ((T_NEO_PIXEL_BUS*) neoPixelBus)->SetPixelColor(i, c);
+          if(streamHeaderLength < 2 && b != (streamHeaderLength ? 'G' : 'N')) {
+            streamHeaderLength = b == 'N' ? 1 : 0;
+            continue;
+          }
+          streamHeader[streamHeaderLength++] = b;
+          if(streamHeaderLength < StreamHeaderSize) continue;
+
+          uint8_t channels = streamHeader[3];
+          bool wireOrder = streamHeader[2] & NeoGfxStreamWireOrder;
+          if(channels < 2 || channels > 4 || (wireOrder && channels != T_COLOR_FEATURE::PixelSize)) {
+            streamHeaderLength = 0;
+            continue;
+          }
+          streamPixel = 0;
+          streamPartLength = 0;
+        } else {
+          uint8_t channels = streamHeader[3];
+          uint16_t count = streamHeader[6] | (streamHeader[7] << 8);
+
+          if(streamPartLength || length < channels) {
+            // a pixel split between two chunks
+            while(length && streamPartLength < channels) {
+              streamPart[streamPartLength++] = *data++;
+              length--;
+            }
+            if(streamPartLength < channels) break;
+
+            writeStreamPixels(streamPart, 1);
+            streamPartLength = 0;
+          } else {
+            size_t n = length / channels;
+            if(n > (size_t)(count - streamPixel)) n = count - streamPixel;
+
+            writeStreamPixels(data, n);
+            data   += n * channels;
+            length -= n * channels;
+          }
+        }
+
+        if(streamHeaderLength == StreamHeaderSize && streamPixel == (streamHeader[6] | (streamHeader[7] << 8))) {
+          if(streamHeader[2] & NeoGfxStreamEndOfFrame) endOfFrame = true;
+          streamHeaderLength = 0;
+        }
+      }
+      return endOfFrame;
+    }
+
+    // Drops a partly received packet, e.g. after a timeout of the sender.
+    void resetStream() {
+      streamHeaderLength = 0;
+    }
+
+    // Native text colors (colors of the feature, e.g. RgbwColor) are used
+    // by the wrappers' write() until a 16-bit text color is set again. The
+    // text is transparent if bg equals fg. Ignored with indexed colors.
+    void setNativeTextColor(typename T_COLOR_FEATURE::ColorObject fg, typename T_COLOR_FEATURE::ColorObject bg) {
+      if(indexBuffer) return;
+      nativeTextFg   = fg;
+      nativeTextBg   = bg;
+      nativeTextFlag = true;
+    }
+
+    void clearNativeTextColor() {
+      nativeTextFlag = false;
+    }
+
+    bool hasNativeTextColor() const {
+      return nativeTextFlag;
     }
 
     // Pass-through is a kludge that lets you override the current drawing
@@ -107,11 +956,11 @@ class NeoGfx {
     // only 'transparent' text/bitmaps.  Also, no gamma correction.
     // Remember to UNSET the passthrough color immediately when done with
     // it (call with no value)!
+    // Prefer the drawing methods of the wrappers which take a ColorObject.
 
     // Pass raw color value to set/enable passthrough
     void setPassThruColor(uint32_t c) {
-      passThruColor =  RgbColor(HtmlColor(c));
-      passThruFlag  = true;
+      setPassThruColor(typename T_COLOR_FEATURE::ColorObject(RgbColor(HtmlColor(c))));
     }
 
     /**
@@ -128,31 +977,1780 @@ class NeoGfx {
       passThruFlag = false;
     }
     
-    void setRemapFunction(uint16_t (*fn)(uint16_t, uint16_t)) {
+    void setRemapFunction(NeoGfxIndex (*fn)(uint16_t, uint16_t)) {
       remapFn = fn;
+#ifdef NEOGFX_LARGE_MATRIX
+      remapFn16 = NULL;
+#endif
+      if(remapTable) buildRemapTable();
     }
 
-    // Downgrade 24-bit color to 16-bit (add reverse gamma lookup here?)
-    uint16_t Color(uint8_t r, uint8_t g, uint8_t b) {
-      return ((uint16_t)(r & 0xF8) << 8) |
-              ((uint16_t)(g & 0xFC) << 3) |
-                        (b         >> 3);
+#ifdef NEOGFX_LARGE_MATRIX
+    // Remap functions written for the 16-bit indices.
+    void setRemapFunction(uint16_t (*fn)(uint16_t, uint16_t)) {
+      remapFn = NULL;
+      remapFn16 = fn;
+      if(remapTable) buildRemapTable();
+    }
+#endif
+
+    // Uses a precomputed table in PROGMEM instead of a remap function.
+    // The table holds the pixel index for every unrotated position
+    // (index y * width + x). Pass NULL to go back to the remap function.
+    void setRemapTable_P(const NeoGfxIndex* table) {
+      remapTable_P = table;
+      if(remapTable) buildRemapTable();
     }
 
-    // Expand 16-bit input color (Adafruit_GFX colorspace) to 24-bit (NeoPixel)
-    // (w/gamma adjustment)
-    static uint32_t expandColor(uint16_t color) {
-      return ((uint32_t)pgm_read_byte(&gamma5[ color >> 11       ]) << 16) |
-              ((uint32_t)pgm_read_byte(&gamma6[(color >> 5) & 0x3F]) <<  8) |
-                        pgm_read_byte(&gamma5[ color       & 0x1F]);
+    // Has to be called whenever the rotation of the Adafruit_GFX changes.
+    void setRotation(uint8_t rotation) {
+      currentRotation = rotation;
+      if(remapTable) buildRemapTable();
+
+      // the dirty rect can't be kept in the old coordinates
+      if(dirty) {
+        resetDirty();
+        markDirty();
+      }
     }
 
- protected:    
-    const uint8_t matrixWidth, matrixHeight;
-    uint16_t (*remapFn)(uint16_t x, uint16_t y);
+    // With a back buffer all drawing goes to an off-screen copy of the
+    // pixels, so the next frame can be drawn while the bus still sends the
+    // last one. present() copies it to the bus. The back buffer holds the
+    // colors before brightness scaling.
+    // Returns false if there is not enough memory.
+    bool enableBackBuffer() {
+      if(indexBuffer) return false;
+      if(!backBuffer) {
+        size_t size = (size_t)neoPixelBus->PixelCount() * T_COLOR_FEATURE::PixelSize;
+        backBuffer = (uint8_t*) malloc(size);
+        if(!backBuffer) return false;
 
-    typename T_COLOR_FEATURE::ColorObject passThruColor;
-    boolean passThruFlag = false;
+        // start with the colors currently on the bus
+        for(uint16_t i=0; i<neoPixelBus->PixelCount(); i++) {
+          T_COLOR_FEATURE::applyPixelColor(backBuffer, i, ((T_NEO_PIXEL_BUS*) neoPixelBus)->GetPixelColor(i));
+        }
+        recountPower();
+      }
+      return true;
+    }
+
+    // The sprites and the power limit are removed as well.
+    void freeBackBuffer() {
+      freeOutputTable();
+      free(backBuffer);
+      backBuffer = NULL;
+      powerLimit = 0;
+      limitBrightness = 255;
+      recountPower();
+
+      for(uint8_t id=0; id<NEOGFX_SPRITE_COUNT; id++) {
+        sprites[id].pixels = NULL;
+      }
+      spriteCount = 0;
+    }
+
+    // The output table applies gamma correction and brightness in one
+    // lookup per byte while present() copies the back buffer to the bus.
+    // The back buffer then holds the colors without both, so changing the
+    // brightness only rebuilds the table (256 entries per byte of a pixel),
+    // without redrawing and without losing precision. Full colors are
+    // gamma corrected as well, every channel with its own gamma. Bytes
+    // which are no channel (e.g. the prefix of DotStars) are copied as
+    // they are.
+    // Enables the back buffer, pixels drawn before are not converted.
+    // Returns false if there is not enough memory.
+    bool enableOutputTable(uint8_t brightness = 255) {
+      if(!outputTable) {
+        if(!enableBackBuffer()) return false;
+        outputTable = (uint8_t*) malloc(256 * T_COLOR_FEATURE::PixelSize);
+        if(!outputTable) return false;
+        probeChannels();
+        resetColorCache();
+        recountPower();
+      }
+      setOutputBrightness(brightness);
+      return true;
+    }
+
+    void freeOutputTable() {
+      if(!outputTable) return;
+
+      free(outputTable);
+      outputTable = NULL;
+      resetColorCache();
+      recountPower();
+      markDirty();
+    }
+
+    bool hasOutputTable() const {
+      return outputTable != NULL;
+    }
+
+    void setOutputBrightness(uint8_t brightness) {
+      outputBrightness = brightness;
+      if(!outputTable) return;
+
+      buildOutputTable();
+      markDirty();
+    }
+
+    uint8_t getOutputBrightness() const {
+      return outputBrightness;
+    }
+
+    // Indexed colors: the pixels are kept as 4- or 8-bit indices into a
+    // palette of 16 or 256 colors, which are expanded to the bus on every
+    // show(). The 16-bit colors passed to the drawing functions (including
+    // drawBitmap and drawRGBBitmap) are then palette indices instead of 565
+    // colors, drawGrayscaleBitmap takes its bytes as indices and frame
+    // streams only their 2-channel packets. The colors of the feature,
+    // drawRGB24Bitmap and drawNativeBitmap carry no index and draw nothing,
+    // the pass-through color is ignored. Changing
+    // a palette entry recolors all its pixels with the next show(), without
+    // redrawing, e.g. for color cycling. Costs half or one byte per pixel
+    // plus the palette in the order of the feature. Can't be combined with
+    // the back buffer (and so neither with sprites nor the output table).
+    // The palette starts black, the pixels with index 0.
+    // Returns false if there is not enough memory.
+    bool enableIndexedColor(uint8_t bits = 8) {
+      if(bits != 4 && bits != 8) return false;
+      if(backBuffer) return false;
+      freeIndexedColor();
+
+      uint16_t entries = 1 << bits;
+      indexBuffer = (uint8_t*) calloc(((size_t)neoPixelBus->PixelCount() * bits + 7) / 8, 1);
+      palette = (uint8_t*) malloc(entries * T_COLOR_FEATURE::PixelSize);
+      if(!indexBuffer || !palette) {
+        freeIndexedColor();
+        return false;
+      }
+
+      indexBits = bits;
+      nativeTextFlag = false;
+      for(uint16_t i=0; i<entries; i++) {
+        T_COLOR_FEATURE::applyPixelColor(palette, i, expandColorObject(0));
+      }
+      markDirty();
+      return true;
+    }
+
+    void freeIndexedColor() {
+      free(indexBuffer);
+      free(palette);
+      indexBuffer = NULL;
+      palette = NULL;
+      indexBits = 0;
+    }
+
+    bool hasIndexedColor() const {
+      return indexBuffer != NULL;
+    }
+
+    // The 565 color is gamma corrected like any other.
+    void setPaletteColor(uint8_t index, uint16_t color) {
+      setPaletteColor(index, expandColorObject(color));
+    }
+
+    void setPaletteColor(uint8_t index, typename T_COLOR_FEATURE::ColorObject color) {
+      if(!palette || index >= (1 << indexBits)) return;
+
+      T_COLOR_FEATURE::applyPixelColor(palette, index, color);
+      markDirty();
+    }
+
+    typename T_COLOR_FEATURE::ColorObject getPaletteColor(uint8_t index) const {
+      if(!palette || index >= (1 << indexBits)) return expandColorObject(0);
+      return T_COLOR_FEATURE::retrievePixelColor(palette, index);
+    }
+
+    // Rotates the count entries starting at first by one: each entry gets
+    // the color of the one before, the first the color of the last.
+    void cyclePalette(uint8_t first, uint16_t count) {
+      if(!palette || count < 2 || first + count > (1 << indexBits)) return;
+
+      const uint8_t size = T_COLOR_FEATURE::PixelSize;
+      uint8_t* start = palette + first * size;
+      uint8_t last[T_COLOR_FEATURE::PixelSize];
+
+      memcpy(last, start + (count - 1) * size, size);
+      memmove(start + size, start, (count - 1) * size);
+      memcpy(start, last, size);
+      markDirty();
+    }
+
+    // Power estimate: the sums of the bytes of all pixels are kept up to
+    // date while drawing, so the current of a frame is known without going
+    // over the pixels again. The model gives the current of a fully lit
+    // channel and of a dark pixel. Not counted are sprites and pixels
+    // written to the bus directly (call recountPower() afterwards). With
+    // indexed colors the pixels are counted by every show().
+    void enablePowerEstimate(const NeoGfxPowerModel& model = NeoGfxPowerModel()) {
+      powerModel = model;
+      probeChannels();
+      powerTracking = true;
+      recountPower();
+    }
+
+    // Removes the power limit as well.
+    void disablePowerEstimate() {
+      powerTracking = false;
+      powerLimit = 0;
+      limitPower();
+    }
+
+    bool hasPowerEstimate() const {
+      return powerTracking;
+    }
+
+    // Counts all pixels again.
+    void recountPower() {
+      if(!powerTracking) return;
+
+      memset(powerSums, 0, sizeof(powerSums));
+      addPower(backBuffer ? backBuffer : neoPixelBus->Pixels(), neoPixelBus->PixelCount(), true);
+    }
+
+    // The estimated current (in mA) of the frame as the next present() (or
+    // show() without a back buffer) sends it, with the output brightness
+    // and the power limit applied.
+    uint32_t getPowerEstimate() {
+      if(!powerTracking) return 0;
+
+      uint64_t channels = channelMicroamps();
+      return (idleMicroamps() + (channels * (powerLimitBrightness(channels) + 1) >> 8)) / 1000;
+    }
+
+    // The same without the power limit, what the frame would draw.
+    uint32_t getPowerDemand() {
+      if(!powerTracking) return 0;
+
+      return (idleMicroamps() + channelMicroamps()) / 1000;
+    }
+
+    // The sums of the bytes of all pixels, in the order of the feature.
+    // With the output table these are the gamma corrected values.
+    void getPowerSums(uint32_t* sums) const {
+      memcpy(sums, powerSums, sizeof(powerSums));
+    }
+
+    // Keeps the estimated current below milliamps (0: no limit) by scaling
+    // the output brightness in present(). The pixels keep their values, so
+    // the brightness comes back when a frame draws less. Enables the back
+    // buffer and the power estimate (with the default model if it wasn't
+    // enabled before). Returns false if there is not enough memory.
+    bool setPowerLimit(uint32_t milliamps) {
+      if(milliamps) {
+        if(!enableBackBuffer()) return false;
+        if(!powerTracking) enablePowerEstimate();
+      }
+      powerLimit = milliamps;
+      limitPower();
+      return true;
+    }
+
+    uint32_t getPowerLimit() const {
+      return powerLimit;
+    }
+
+    // The scaling of the last presented frame, 255 if it wasn't limited.
+    uint8_t getPowerLimitBrightness() const {
+      return limitBrightness;
+    }
+
+    // Sprites are bitmaps of colors of the feature which are blended over
+    // the back buffer by present(), so they can be moved over a background
+    // without redrawing it. Higher z is on top, alpha 255 is opaque and
+    // pixels with the color key are left out. The bitmap (w x h, in RAM)
+    // has to stay valid while the sprite is used. Only the area which
+    // changed since the last present() is composed again, the rest of the
+    // last frame stays on the bus.
+    // Returns the id of the sprite or -1 if all are used (or there is not
+    // enough memory for the back buffer, which is enabled).
+    int8_t addSprite(const typename T_COLOR_FEATURE::ColorObject* pixels, int16_t w, int16_t h, int16_t x = 0, int16_t y = 0, int8_t z = 0) {
+      for(int8_t id=0; id<NEOGFX_SPRITE_COUNT; id++) {
+        Sprite& sprite = sprites[id];
+        if(sprite.pixels) continue;
+
+        if(!backBuffer) {
+          if(!enableBackBuffer()) return -1;
+          markDirty();
+        }
+
+        sprite.pixels  = pixels;
+        sprite.x       = x;
+        sprite.y       = y;
+        sprite.w       = w;
+        sprite.h       = h;
+        sprite.z       = z;
+        sprite.alpha   = 255;
+        sprite.visible = true;
+        sprite.keyed   = false;
+        spriteCount++;
+        markSprite(sprite);
+        return id;
+      }
+      return -1;
+    }
+
+    void removeSprite(int8_t id) {
+      if(!isSprite(id)) return;
+
+      markSprite(sprites[id]);
+      sprites[id].pixels = NULL;
+      spriteCount--;
+    }
+
+    void moveSprite(int8_t id, int16_t x, int16_t y) {
+      if(!isSprite(id)) return;
+
+      markSprite(sprites[id]);
+      sprites[id].x = x;
+      sprites[id].y = y;
+      markSprite(sprites[id]);
+    }
+
+    // Changes the bitmap, e.g. for the next frame of an animation.
+    void setSpritePixels(int8_t id, const typename T_COLOR_FEATURE::ColorObject* pixels) {
+      if(!isSprite(id)) return;
+
+      sprites[id].pixels = pixels;
+      markSprite(sprites[id]);
+    }
+
+    void setSpriteZ(int8_t id, int8_t z) {
+      if(!isSprite(id)) return;
+
+      sprites[id].z = z;
+      markSprite(sprites[id]);
+    }
+
+    void setSpriteAlpha(int8_t id, uint8_t alpha) {
+      if(!isSprite(id)) return;
+
+      sprites[id].alpha = alpha;
+      markSprite(sprites[id]);
+    }
+
+    void setSpriteColorKey(int8_t id, typename T_COLOR_FEATURE::ColorObject key) {
+      if(!isSprite(id)) return;
+
+      sprites[id].key   = key;
+      sprites[id].keyed = true;
+      markSprite(sprites[id]);
+    }
+
+    void clearSpriteColorKey(int8_t id) {
+      if(!isSprite(id)) return;
+
+      sprites[id].keyed = false;
+      markSprite(sprites[id]);
+    }
+
+    void setSpriteVisible(int8_t id, bool visible) {
+      if(!isSprite(id)) return;
+
+      markSprite(sprites[id]);
+      sprites[id].visible = visible;
+      markSprite(sprites[id]);
+    }
+
+    // Copies the back buffer to the bus and starts showing it, if the bus
+    // is ready. Returns false without waiting if the bus is still busy.
+    bool present() {
+      if(!neoPixelBus->CanShow()) return false;
+      if(powerLimit) limitPower();
+
+      if(backBuffer && spriteCount) {
+        if(dirty) composeDirtyRect();
+        neoPixelBus->Dirty();
+        resetDirty();
+      } else if(backBuffer) {
+        if(outputTable) {
+          copyOutputTable();
+        } else {
+          copyBackBuffer((T_NEO_PIXEL_BUS*) neoPixelBus);
+        }
+        neoPixelBus->Dirty();
+        resetDirty();
+      }
+      show();
+      return true;
+    }
+
+    // Shows the current frame: with a back buffer (also enabled by sprites,
+    // the output table and the power limit) it is presented once the bus
+    // is ready, otherwise the pixels of the bus are shown.
+    void showFrame(bool maintainBufferConsistency = true) {
+      if(!backBuffer) {
+        show(maintainBufferConsistency);
+        return;
+      }
+      while(!present()) {
+        yield();
+      }
+    }
+
+    // Shows (or presents) the frame only if a pixel changed since it was
+    // shown last. Returns true if the frame was shown.
+    bool showIfDirty() {
+      if(!dirty) return false;
+      if(backBuffer) return present();
+
+      show();
+      return true;
+    }
+
+    // Dirty tracking: every write which actually changes the value of a
+    // pixel marks the frame dirty and grows the dirty rect (in the
+    // coordinates of the current rotation) to contain it.
+    bool isDirty() const {
+      return dirty;
+    }
+
+    // Returns false (and leaves the arguments untouched) if nothing changed.
+    bool getDirtyRect(int16_t& x, int16_t& y, int16_t& w, int16_t& h) const {
+      if(!dirty) return false;
+
+      x = dirtyX0;
+      y = dirtyY0;
+      w = dirtyX1 - dirtyX0;
+      h = dirtyY1 - dirtyY0;
+      return true;
+    }
+
+    void resetDirty() {
+      dirty = false;
+    }
+
+    // Marks the whole matrix as changed, e.g. after writing to the bus
+    // directly or changing the brightness.
+    void markDirty() {
+      bool swap = currentRotation & 1;
+      markDirty(0, 0, swap ? matrixHeight : matrixWidth, swap ? matrixWidth : matrixHeight);
+    }
+
+    void markDirty(int16_t x, int16_t y, int16_t w, int16_t h) {
+      if(!dirty) {
+        dirtyX0 = x;
+        dirtyY0 = y;
+        dirtyX1 = x + w;
+        dirtyY1 = y + h;
+        dirty = true;
+        return;
+      }
+
+      if(x < dirtyX0) dirtyX0 = x;
+      if(y < dirtyY0) dirtyY0 = y;
+      if(x + w > dirtyX1) dirtyX1 = x + w;
+      if(y + h > dirtyY1) dirtyY1 = y + h;
+    }
+
+    // The remap table caches the index of every pixel for the current
+    // rotation, so drawing needs a single table load per pixel instead of
+    // the rotation math and a call of the remap function.
+    // It costs 2 bytes of RAM per pixel. Returns false if there is not
+    // enough memory; drawing then falls back to the remap function.
+    bool enableRemapTable() {
+      if(!remapTable) {
+        remapTable = (NeoGfxIndex*) malloc(sizeof(NeoGfxIndex) * matrixWidth * matrixHeight);
+        if(!remapTable) return false;
+      }
+      buildRemapTable();
+      return true;
+    }
+
+    // Refills an enabled remap table, e.g. after the topology used by the
+    // remap function changed.
+    void buildRemapTable() {
+      if(!remapTable) return;
+
+      bool swap = currentRotation & 1;
+      int16_t w = swap ? matrixHeight : matrixWidth;
+      int16_t h = swap ? matrixWidth  : matrixHeight;
+      NeoGfxIndex* entry = remapTable;
+
+      for(int16_t y = 0; y < h; y++) {
+        for(int16_t x = 0; x < w; x++) {
+          switch(currentRotation) {
+          case 1:
+            *entry++ = mapPixel(matrixWidth - 1 - y, x);
+            break;
+          case 2:
+            *entry++ = mapPixel(matrixWidth - 1 - x, matrixHeight - 1 - y);
+            break;
+          case 3:
+            *entry++ = mapPixel(y, matrixHeight - 1 - x);
+            break;
+          default:
+            *entry++ = mapPixel(x, y);
+            break;
+          }
+        }
+      }
+    }
+
+    // Releases the remap table and goes back to remapping on every draw.
+    void freeRemapTable() {
+      free(remapTable);
+      remapTable = NULL;
+    }
+
+    // The color table holds the converted color for all 65536 colors, so
+    // no color has to be expanded while drawing. It needs 65536 times the
+    // size of a ColorObject (192KB for RGB), so it only makes sense on
+    // boards with a lot of RAM (e.g. ESP32 with PSRAM).
+    // Returns false if there is not enough memory.
+    bool enableColorTable() {
+      if(!colorTable) {
+        colorTable = (typename T_COLOR_FEATURE::ColorObject*) malloc(sizeof(typename T_COLOR_FEATURE::ColorObject) * 65536UL);
+        if(!colorTable) return false;
+
+        for(uint32_t color=0; color<65536UL; color++) {
+          colorTable[color] = expandToFeature(color);
+        }
+      }
+      return true;
+    }
+
+    void freeColorTable() {
+      free(colorTable);
+      colorTable = NULL;
+    }
+
+    // The glyph cache keeps the characters drawn by Adafruit_GFX::drawChar
+    // as 1-bit bitmaps (per font and text size), so text is drawn with one
+    // clipped bitmap write per character instead of a drawPixel call per
+    // set bit. bytes is the memory used for the glyphs (at most 65534);
+    // when it is full the cache starts over.
+    // Returns false if there is not enough memory.
+    bool enableGlyphCache(uint16_t bytes = NEOGFX_GLYPH_CACHE_SIZE) {
+      if(glyphCache && glyphCacheSize == bytes) return true;
+
+      freeGlyphCache();
+      if(bytes == NoGlyph) bytes--;
+      glyphCache = (uint8_t*) malloc(bytes);
+      if(!glyphCache) return false;
+
+      glyphCacheSize = bytes;
+      clearGlyphCache();
+      return true;
+    }
+
+    void freeGlyphCache() {
+      free(glyphCache);
+      glyphCache = NULL;
+      glyphCacheSize = 0;
+    }
+
+    // Drops the cached glyphs, e.g. after the font data or cp437() changed.
+    void clearGlyphCache() {
+      glyphCacheUsed = 0;
+      for(uint8_t i=0; i<GlyphBuckets; i++) {
+        glyphBuckets[i] = NoGlyph;
+      }
+    }
+
+    bool hasGlyphCache() const {
+      return glyphCache != NULL;
+    }
+
+    // The text output of Adafruit_GFX::write (cursor, wrap and fonts), with
+    // the characters drawn from the glyph cache. gfx is the wrapper, it
+    // rasterizes the glyphs which are not cached yet. T_COLOR is a 16-bit
+    // color or a color of the feature.
+    template<typename T_COLOR>
+    size_t write(Adafruit_GFX* gfx, uint8_t c, int16_t& cursorX, int16_t& cursorY, const GFXfont* font, uint8_t sizeX, uint8_t sizeY, T_COLOR color, T_COLOR bg, bool wrap, uint16_t _width, uint16_t _height,  uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      if(c == '\r') return 1;
+
+      if(!font) {
+        if(c == '\n') {
+          cursorX = 0;
+          cursorY += sizeY * 8;
+          return 1;
+        }
+        if(wrap && (cursorX + sizeX * 6) > (int16_t)_width) {
+          cursorX = 0;
+          cursorY += sizeY * 8;
+        }
+        drawGlyph(gfx, NULL, cursorX, cursorY, c, 0, 0, 6, 8, color, bg, sizeX, sizeY, _width, _height, rotation, WIDTH, HEIGHT);
+        cursorX += sizeX * 6;
+        return 1;
+      }
+
+      GFXfont f;
+      memcpy_P(&f, font, sizeof(f));
+
+      if(c == '\n') {
+        cursorX = 0;
+        cursorY += sizeY * f.yAdvance;
+        return 1;
+      }
+      if(c < f.first || c > f.last) return 1;
+
+      GFXglyph glyph;
+      memcpy_P(&glyph, &f.glyph[c - f.first], sizeof(glyph));
+
+      if(glyph.width > 0 && glyph.height > 0) {
+        if(wrap && (cursorX + sizeX * (glyph.xOffset + glyph.width)) > (int16_t)_width) {
+          cursorX = 0;
+          cursorY += sizeY * f.yAdvance;
+        }
+        // custom fonts are always transparent
+        drawGlyph(gfx, font, cursorX, cursorY, c, glyph.xOffset, glyph.yOffset, glyph.width, glyph.height, color, color, sizeX, sizeY, _width, _height, rotation, WIDTH, HEIGHT);
+      }
+      cursorX += glyph.xAdvance * (int16_t)sizeX;
+      return 1;
+    }
+
+    // The same with the native text colors. Without the glyph cache the
+    // glyphs are rasterized into a temporary buffer.
+    size_t writeNativeText(Adafruit_GFX* gfx, uint8_t c, int16_t& cursorX, int16_t& cursorY, const GFXfont* font, uint8_t sizeX, uint8_t sizeY, bool wrap, uint16_t _width, uint16_t _height,  uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      return write(gfx, c, cursorX, cursorY, font, sizeX, sizeY, nativeTextFg, nativeTextBg, wrap, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    // Downgrade 24-bit color to 16-bit (add reverse gamma lookup here?)
+    uint16_t Color(uint8_t r, uint8_t g, uint8_t b) {
+      return ((uint16_t)(r & 0xF8) << 8) |
+              ((uint16_t)(g & 0xFC) << 3) |
+                        (b         >> 3);
+    }
+
+    // Expand 16-bit input color (Adafruit_GFX colorspace) to 24-bit (NeoPixel)
+    // (w/gamma adjustment)
+    static uint32_t expandColor(uint16_t color) {
+      return ((uint32_t)T_GAMMA::red5  ( color >> 11       ) << 16) |
+              ((uint32_t)T_GAMMA::green6((color >> 5) & 0x3F) <<  8) |
+                        T_GAMMA::blue5 ( color       & 0x1F);
+    }
+
+    // Expand 16-bit input color directly to the color of the feature
+    // (w/gamma adjustment)
+    static typename T_COLOR_FEATURE::ColorObject expandColorObject(uint16_t color) {
+      return RgbColor(T_GAMMA::red5  ( color >> 11       ),
+                      T_GAMMA::green6((color >> 5) & 0x3F),
+                      T_GAMMA::blue5 ( color       & 0x1F));
+    }
+
+    // Expand 16-bit input color to the color of the feature
+    // (w/o gamma adjustment)
+    static typename T_COLOR_FEATURE::ColorObject expandLinearColorObject(uint16_t color) {
+      uint8_t r =  color >> 11;
+      uint8_t g = (color >> 5) & 0x3F;
+      uint8_t b =  color       & 0x1F;
+      return RgbColor((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2));
+    }
+
+    // Gamma adjustment of full colors with the 8-bit tables
+    static RgbColor correctGamma(const RgbColor& color) {
+      return RgbColor(T_GAMMA::red8(color.R), T_GAMMA::green8(color.G), T_GAMMA::blue8(color.B));
+    }
+
+    static RgbwColor correctGamma(const RgbwColor& color) {
+      return RgbwColor(T_GAMMA::red8(color.R), T_GAMMA::green8(color.G), T_GAMMA::blue8(color.B), T_GAMMA::white8(color.W));
+    }
+
+ protected:
+    // Returns the index of the pixel at x/y in rotated coordinates.
+    // x and y have to be on the matrix.
+    NeoGfxIndex pixelIndex(int16_t x, int16_t y, uint16_t _width, uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      if(remapTable && rotation == currentRotation) {
+        return remapTable[(NeoGfxIndex)y * _width + x];
+      }
+
+      int16_t t;
+      switch(rotation) {
+      case 1:
+        t = x;
+        x = WIDTH  - 1 - y;
+        y = t;
+        break;
+      case 2:
+        x = WIDTH  - 1 - x;
+        y = HEIGHT - 1 - y;
+        break;
+      case 3:
+        t = x;
+        x = y;
+        y = HEIGHT - 1 - t;
+        break;
+      }
+
+      return mapPixel(x, y);
+    }
+
+    uint8_t* pixelAddress(NeoGfxIndex index) {
+      return (backBuffer ? backBuffer : neoPixelBus->Pixels()) + (size_t)index * T_COLOR_FEATURE::PixelSize;
+    }
+
+    // Maps row k of the order of scroll() into its slot of the ring.
+    NeoGfxIndex* mapScrollRow(NeoGfxIndex* ring, int16_t k, int16_t dy, int16_t rows, uint16_t _width, uint16_t _height, uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      NeoGfxIndex* row = &ring[(k % rows) * _width];
+      int16_t y = dy > 0 ? _height - 1 - k : k;
+      for(int16_t x = 0; x < (int16_t)_width; x++) {
+        row[x] = pixelIndex(x, y, _width, rotation, WIDTH, HEIGHT);
+      }
+      return row;
+    }
+
+    // Moves the pixels x0 to x0 + w - 1 of a row from x - dx, in the order
+    // which reads every pixel before it is overwritten. Pixels which are
+    // next to each other on the bus in both rows (in the same direction)
+    // are moved as one block.
+    void scrollRow(const NeoGfxIndex* to, const NeoGfxIndex* from, int16_t dx, int16_t x0, int16_t w) {
+      const NeoGfxIndex count = neoPixelBus->PixelCount();
+      const int16_t step = dx > 0 ? -1 : 1;
+      int16_t x = dx > 0 ? x0 + w - 1 : x0;
+
+      for(int16_t left = w; left > 0; ) {
+        NeoGfxIndex t = to[x], f = from[x - dx];
+        if(t >= count || f >= count) {
+          x += step;
+          left--;
+          continue;
+        }
+
+        if(indexBuffer) {
+          setColorIndex(t, colorIndex(f));
+          x += step;
+          left--;
+          continue;
+        }
+
+        // the length and direction of the block
+        int16_t n = 1;
+        int8_t dir = 0;
+        while(n < left) {
+          NeoGfxIndex tn = to[x + n * step], fn = from[x + n * step - dx];
+          int8_t d = tn == t + n ? 1 : (tn + n == t ? -1 : 0);
+          if(d == 0 || (dir != 0 && d != dir) || fn != f + d * n || tn >= count || fn >= count) break;
+          dir = d;
+          n++;
+        }
+
+        NeoGfxIndex first = dir < 0 ? t - (n - 1) : t;
+        NeoGfxIndex source = dir < 0 ? f - (n - 1) : f;
+        if(powerTracking) addPower(pixelAddress(first), n, false);
+        memmove(pixelAddress(first), pixelAddress(source), (size_t)n * T_COLOR_FEATURE::PixelSize);
+        if(powerTracking) addPower(pixelAddress(first), n, true);
+
+        x += n * step;
+        left -= n;
+      }
+    }
+
+    // scroll() pixel by pixel, if there is no memory for the indices of
+    // the rows.
+    void scrollPixels(int16_t dx, int16_t dy, uint16_t _width, uint16_t _height, uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      int16_t w = _width  - abs(dx);
+      int16_t h = _height - abs(dy);
+      int16_t x0 = dx > 0 ? dx : 0;
+      int16_t y0 = dy > 0 ? dy : 0;
+
+      for(int16_t j = 0; j < h; j++) {
+        int16_t y = dy > 0 ? y0 + h - 1 - j : y0 + j;
+
+        for(int16_t i = 0; i < w; i++) {
+          int16_t x = dx > 0 ? x0 + w - 1 - i : x0 + i;
+
+          NeoGfxIndex to   = pixelIndex(x, y, _width, rotation, WIDTH, HEIGHT);
+          NeoGfxIndex from = pixelIndex(x - dx, y - dy, _width, rotation, WIDTH, HEIGHT);
+          if(to >= neoPixelBus->PixelCount() || from >= neoPixelBus->PixelCount()) continue;
+
+          if(indexBuffer) {
+            setColorIndex(to, colorIndex(from));
+          } else {
+            if(powerTracking) trackPower(pixelAddress(to), pixelAddress(from));
+            memcpy(pixelAddress(to), pixelAddress(from), T_COLOR_FEATURE::PixelSize);
+          }
+        }
+      }
+    }
+
+    // Writes a single pixel. Returns true if its value changed.
+    bool setPixel(NeoGfxIndex index, typename T_COLOR_FEATURE::ColorObject c) {
+      if(index >= neoPixelBus->PixelCount()) return false;
+      if(indexBuffer) return setColorIndex(index, c.R);
+
+      uint8_t* pixel = pixelAddress(index);
+      uint8_t old[T_COLOR_FEATURE::PixelSize];
+      memcpy(old, pixel, sizeof(old));
+
+      if(backBuffer) {
+        T_COLOR_FEATURE::applyPixelColor(backBuffer, index, c);
+      } else {
+        setBusPixel((T_NEO_PIXEL_BUS*) neoPixelBus, index, c);
+      }
+      if(powerTracking) trackPower(old, pixel);
+      return memcmp(old, pixel, sizeof(old)) != 0;
+    }
+
+    // The views of the bands write the pixels without setting the dirty
+    // flag of the bus, which all bands would write at once. renderBands
+    // sets it after the bands are done.
+    void setBusPixel(NeoPixelBus<T_COLOR_FEATURE, T_METHOD>* bus, NeoGfxIndex index, typename T_COLOR_FEATURE::ColorObject c) {
+      T_COLOR_FEATURE::applyPixelColor(bus->Pixels(), index, c);
+      if(!sharedBuffers) bus->Dirty();
+    }
+
+    // Other buses (e.g. NeoPixelBrightnessBus) may change the colors on
+    // SetPixelColor, their bands are rendered one after the other.
+    template<typename T_BUS>
+    void setBusPixel(T_BUS* bus, NeoGfxIndex index, typename T_COLOR_FEATURE::ColorObject c) {
+      bus->SetPixelColor(index, c);
+    }
+
+    // In indexed mode the palette index travels through the drawing code
+    // in the red channel of a color.
+    typename T_COLOR_FEATURE::ColorObject indexColor(uint16_t color) {
+      typename T_COLOR_FEATURE::ColorObject c(0);
+      c.R = color & ((1 << indexBits) - 1);
+      return c;
+    }
+
+    uint8_t colorIndex(NeoGfxIndex index) const {
+      if(indexBits == 8) return indexBuffer[index];
+      return (indexBuffer[index >> 1] >> (index & 1 ? 4 : 0)) & 0x0F;
+    }
+
+    // Returns true if the index of the pixel changed.
+    bool setColorIndex(NeoGfxIndex index, uint8_t value) {
+      if(indexBits == 8) {
+        if(indexBuffer[index] == value) return false;
+        indexBuffer[index] = value;
+        return true;
+      }
+
+      uint8_t shift = index & 1 ? 4 : 0;
+      uint8_t& b = indexBuffer[index >> 1];
+      uint8_t old = b;
+      b = (b & ~(0x0F << shift)) | ((value & 0x0F) << shift);
+      return b != old;
+    }
+
+    // Writes the palette colors of all pixels to the bus.
+    void expandIndices(NeoPixelBus<T_COLOR_FEATURE, T_METHOD>* bus) {
+      uint8_t* out = bus->Pixels();
+      for(uint16_t i=0; i<bus->PixelCount(); i++, out += T_COLOR_FEATURE::PixelSize) {
+        memcpy(out, palette + colorIndex(i) * T_COLOR_FEATURE::PixelSize, T_COLOR_FEATURE::PixelSize);
+      }
+      bus->Dirty();
+    }
+
+    // Other buses (e.g. NeoPixelBrightnessBus) may change the colors on
+    // SetPixelColor.
+    template<typename T_BUS>
+    void expandIndices(T_BUS* bus) {
+      for(uint16_t i=0; i<bus->PixelCount(); i++) {
+        bus->SetPixelColor(i, T_COLOR_FEATURE::retrievePixelColor(palette, colorIndex(i)));
+      }
+    }
+
+    // Finds the channel of every byte of a pixel, its value for black and
+    // the range up to a fully lit channel. Bytes which are no channel (e.g.
+    // the prefix of DotStars) get a range of 0. Used by the power estimate
+    // and the output table.
+    void probeChannels() {
+      uint8_t data[4] = { 0, 0, 0, 0 };
+      uint8_t lit[T_COLOR_FEATURE::PixelSize];
+      T_COLOR_FEATURE::applyPixelColor(powerBlack, 0, streamColor(data, 4, (typename T_COLOR_FEATURE::ColorObject*) NULL));
+      memset(powerChannel, 0, sizeof(powerChannel));
+      memset(powerRange, 0, sizeof(powerRange));
+
+      for(uint8_t channel=0; channel<4; channel++) {
+        memset(data, 0, sizeof(data));
+        data[channel] = 255;
+        T_COLOR_FEATURE::applyPixelColor(lit, 0, streamColor(data, 4, (typename T_COLOR_FEATURE::ColorObject*) NULL));
+
+        for(uint8_t i=0; i<T_COLOR_FEATURE::PixelSize; i++) {
+          if(lit[i] > powerBlack[i]) {
+            powerChannel[i] = channel;
+            powerRange[i]   = lit[i] - powerBlack[i];
+          }
+        }
+      }
+    }
+
+    static uint8_t channelGamma(uint8_t channel, uint8_t value) {
+      switch(channel) {
+      case 0:  return T_GAMMA::red8(value);
+      case 1:  return T_GAMMA::green8(value);
+      case 2:  return T_GAMMA::blue8(value);
+      default: return T_GAMMA::white8(value);
+      }
+    }
+
+    // With the output table the gamma correction is applied on output, so
+    // the gamma corrected values of byte i are counted.
+    uint8_t powerLevel(uint8_t i, uint8_t value) const {
+      if(!outputTable || !powerRange[i] || value <= powerBlack[i]) return value;
+
+      uint8_t level = (value - powerBlack[i]) * 255 / powerRange[i];
+      return powerBlack[i] + channelGamma(powerChannel[i], level) * powerRange[i] / 255;
+    }
+
+    // A pixel changes from the bytes old to the bytes pixel.
+    void trackPower(const uint8_t* old, const uint8_t* pixel) {
+      for(uint8_t i=0; i<T_COLOR_FEATURE::PixelSize; i++) {
+        powerSums[i] += powerLevel(i, pixel[i]) - powerLevel(i, old[i]);
+      }
+    }
+
+    // Adds (or removes) n pixels to the sums.
+    void addPower(const uint8_t* pixels, size_t n, bool add) {
+      for(size_t p=0; p<n; p++, pixels += T_COLOR_FEATURE::PixelSize) {
+        for(uint8_t i=0; i<T_COLOR_FEATURE::PixelSize; i++) {
+          if(add) {
+            powerSums[i] += powerLevel(i, pixels[i]);
+          } else {
+            powerSums[i] -= powerLevel(i, pixels[i]);
+          }
+        }
+      }
+    }
+
+    uint16_t channelModel(uint8_t channel) const {
+      switch(channel) {
+      case 0:  return powerModel.red;
+      case 1:  return powerModel.green;
+      case 2:  return powerModel.blue;
+      default: return powerModel.white;
+      }
+    }
+
+    uint64_t idleMicroamps() const {
+      return (uint64_t)powerModel.idle * neoPixelBus->PixelCount();
+    }
+
+    // The current of the lit channels (in uA) with the output brightness
+    // but without the power limit. The brightness of a
+    // NeoPixelBrightnessBus is already in its pixels, unless they are
+    // copied from the back buffer.
+    uint64_t channelMicroamps() {
+      uint32_t count = neoPixelBus->PixelCount();
+      uint64_t current = 0;
+
+      for(uint8_t i=0; i<T_COLOR_FEATURE::PixelSize; i++) {
+        if(!powerRange[i]) continue;
+
+        uint8_t black = powerLevel(i, powerBlack[i]);
+        uint8_t range = powerLevel(i, powerBlack[i] + powerRange[i]) - black;
+        if(!range) continue;
+
+        uint32_t sum = powerSums[i] - (uint32_t)black * count;
+        current += (uint64_t)sum * channelModel(powerChannel[i]) / range;
+      }
+
+      uint8_t brightness = 255;
+      if(outputTable) {
+        brightness = outputBrightness;
+      } else if(backBuffer) {
+        brightness = busBrightness((T_NEO_PIXEL_BUS*) neoPixelBus);
+      }
+      return current * (brightness + 1) >> 8;
+    }
+
+    uint8_t busBrightness(NeoPixelBus<T_COLOR_FEATURE, T_METHOD>*) const {
+      return 255;
+    }
+
+    template<typename T_BUS>
+    uint8_t busBrightness(T_BUS* bus) const {
+      return bus->GetBrightness();
+    }
+
+    // The scaling which keeps the frame within the power limit.
+    uint8_t powerLimitBrightness(uint64_t channels) const {
+      if(!powerLimit) return 255;
+
+      uint64_t idle   = idleMicroamps();
+      uint64_t budget = (uint64_t)powerLimit * 1000;
+      if(idle + channels <= budget) return 255;
+      if(idle >= budget) return 0;
+
+      uint64_t scale = (budget - idle) * 256 / channels;
+      return scale ? scale - 1 : 0;
+    }
+
+    // Applies the scaling for the current frame. A changed scaling changes
+    // every pixel on output.
+    void limitPower() {
+      uint8_t brightness = powerLimit ? powerLimitBrightness(channelMicroamps()) : 255;
+      if(brightness == limitBrightness) return;
+
+      limitBrightness = brightness;
+      if(outputTable) buildOutputTable();
+      markDirty();
+    }
+
+    // Copies a pixel, its channels scaled by the power limit.
+    void limitPixel(uint8_t* out, const uint8_t* in) const {
+      if(limitBrightness == 255) {
+        memcpy(out, in, T_COLOR_FEATURE::PixelSize);
+        return;
+      }
+
+      for(uint8_t i=0; i<T_COLOR_FEATURE::PixelSize; i++) {
+        if(powerRange[i] && in[i] > powerBlack[i]) {
+          out[i] = powerBlack[i] + (((uint16_t)(in[i] - powerBlack[i]) * (limitBrightness + 1)) >> 8);
+        } else {
+          out[i] = in[i];
+        }
+      }
+    }
+
+    // Whether bytes can be written to the pixels as they are. Other buses
+    // (e.g. NeoPixelBrightnessBus) may change the colors on SetPixelColor.
+    bool writesWire(NeoPixelBus<T_COLOR_FEATURE, T_METHOD>*) const {
+      return true;
+    }
+
+    template<typename T_BUS>
+    bool writesWire(T_BUS*) const {
+      return backBuffer != NULL;
+    }
+
+#ifndef NEOGFX_NO_BULK_CONVERT
+    // The 565 colors of bitmaps and streams can be converted in bulk,
+    // unless the feature doesn't allow it or the colors mean something else.
+    bool canConvertInBulk() const {
+      return wireFormat.size && !indexBuffer && !passThruFlag;
+    }
+
+    // Writes the bytes of a converted pixel, returns true if it changed.
+    bool setWirePixel(NeoPixelBus<T_COLOR_FEATURE, T_METHOD>* bus, NeoGfxIndex index, const uint8_t* bytes) {
+      if(index >= bus->PixelCount()) return false;
+
+      uint8_t* pixel = pixelAddress(index);
+      if(memcmp(pixel, bytes, T_COLOR_FEATURE::PixelSize) == 0) return false;
+
+      if(powerTracking) trackPower(pixel, bytes);
+      memcpy(pixel, bytes, T_COLOR_FEATURE::PixelSize);
+      if(!backBuffer && !sharedBuffers) bus->Dirty();
+      return true;
+    }
+
+    template<typename T_BUS>
+    bool setWirePixel(T_BUS* bus, NeoGfxIndex index, const uint8_t* bytes) {
+      if(backBuffer) return setWirePixel((NeoPixelBus<T_COLOR_FEATURE, T_METHOD>*) bus, index, bytes);
+
+      return setPixel(index, T_COLOR_FEATURE::retrievePixelColor(bytes, 0));
+    }
+
+    // The visible part (i0 - i1, j0 - j1) of an RGB bitmap, converted in
+    // chunks of a row.
+    void drawRGBBitmapInBulk(int16_t x, int16_t y, const uint16_t* bitmap, bool inProgmem, int16_t w, int16_t i0, int16_t j0, int16_t i1, int16_t j1, uint16_t _width, uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      uint16_t colors[NEOGFX_CONVERT_CHUNK];
+      uint32_t wire[NEOGFX_CONVERT_CHUNK];
+
+      for(int16_t j=j0; j<j1; j++) {
+        for(int16_t i=i0; i<i1; i += NEOGFX_CONVERT_CHUNK) {
+          uint16_t n = i1 - i < NEOGFX_CONVERT_CHUNK ? i1 - i : NEOGFX_CONVERT_CHUNK;
+          const uint16_t* in = &bitmap[j * w + i];
+          if(inProgmem) {
+            memcpy_P(colors, in, n * sizeof(uint16_t));
+            in = colors;
+          }
+          neoGfxConvert565(wireFormat, in, (uint8_t*) wire, n);
+
+          const uint8_t* pixel = (const uint8_t*) wire;
+          for(uint16_t k=0; k<n; k++, pixel += wireFormat.size) {
+            if(setWirePixel((T_NEO_PIXEL_BUS*) neoPixelBus, pixelIndex(x + i + k, y + j, _width, rotation, WIDTH, HEIGHT), pixel)) {
+              markDirty(x + i + k, y + j, 1, 1);
+            }
+          }
+        }
+      }
+    }
+#endif
+
+    // Copies the back buffer through the output table. The bus buffer is
+    // written directly, so the brightness of a NeoPixelBrightnessBus is not
+    // applied on top.
+    void copyOutputTable() {
+      uint8_t* out = neoPixelBus->Pixels();
+      const uint8_t* in = backBuffer;
+
+      for(uint16_t n=0; n<neoPixelBus->PixelCount(); n++) {
+        const uint8_t* table = outputTable;
+        for(uint8_t i=0; i<T_COLOR_FEATURE::PixelSize; i++, table += 256) {
+          *out++ = table[*in++];
+        }
+      }
+    }
+
+    // Gamma correction and brightness of the output table, times the
+    // scaling of the power limit. Every byte of a pixel has its own 256
+    // entries, mapping the byte as the feature writes it. Bytes which are
+    // no channel map to themselves.
+    void buildOutputTable() {
+      uint32_t scale = (uint32_t)(outputBrightness + 1) * (limitBrightness + 1);
+
+      for(uint8_t i=0; i<T_COLOR_FEATURE::PixelSize; i++) {
+        uint8_t* table = outputTable + 256 * i;
+        for(uint16_t value=0; value<256; value++) {
+          table[value] = value;
+        }
+        if(!powerRange[i]) continue;
+
+        for(uint16_t level=0; level<256; level++) {
+          uint8_t out = ((uint32_t)channelGamma(powerChannel[i], level) * scale) >> 16;
+          if(powerBlack[i] == 0 && powerRange[i] == 255) {
+            table[level] = out;
+          } else {
+            table[channelByte(i, level)] = channelByte(i, out);
+          }
+        }
+      }
+    }
+
+    // Byte i of a pixel with its channel at level and the others black.
+    uint8_t channelByte(uint8_t i, uint8_t level) const {
+      uint8_t data[4] = { 0, 0, 0, 0 };
+      uint8_t pixel[T_COLOR_FEATURE::PixelSize];
+
+      data[powerChannel[i]] = level;
+      T_COLOR_FEATURE::applyPixelColor(pixel, 0, streamColor(data, 4, (typename T_COLOR_FEATURE::ColorObject*) NULL));
+      return pixel[i];
+    }
+
+    // The plain NeoPixelBus stores the colors as they are, so the back
+    // buffer can be copied as a whole.
+    void copyBackBuffer(NeoPixelBus<T_COLOR_FEATURE, T_METHOD>* bus) {
+      if(limitBrightness == 255) {
+        memcpy(bus->Pixels(), backBuffer, (size_t)bus->PixelCount() * T_COLOR_FEATURE::PixelSize);
+        return;
+      }
+
+      uint8_t* out = bus->Pixels();
+      const uint8_t* in = backBuffer;
+      for(uint16_t i=0; i<bus->PixelCount(); i++, in += T_COLOR_FEATURE::PixelSize, out += T_COLOR_FEATURE::PixelSize) {
+        limitPixel(out, in);
+      }
+    }
+
+    // Other buses (e.g. NeoPixelBrightnessBus) may change the colors on
+    // SetPixelColor.
+    template<typename T_BUS>
+    void copyBackBuffer(T_BUS* bus) {
+      uint8_t pixel[T_COLOR_FEATURE::PixelSize];
+      for(uint16_t i=0; i<bus->PixelCount(); i++) {
+        limitPixel(pixel, backBuffer + (size_t)i * T_COLOR_FEATURE::PixelSize);
+        bus->SetPixelColor(i, T_COLOR_FEATURE::retrievePixelColor(pixel, 0));
+      }
+    }
+
+    struct Sprite {
+      const typename T_COLOR_FEATURE::ColorObject* pixels; // NULL if the sprite is unused
+      int16_t x, y, w, h;
+      int8_t z;
+      uint8_t alpha;
+      bool visible;
+      bool keyed;
+      typename T_COLOR_FEATURE::ColorObject key;
+    };
+
+    bool isSprite(int8_t id) const {
+      return id >= 0 && id < NEOGFX_SPRITE_COUNT && sprites[id].pixels;
+    }
+
+    // Marks the visible part of a shown sprite dirty, so it is composed
+    // again by the next present().
+    void markSprite(const Sprite& sprite) {
+      if(!sprite.visible) return;
+
+      bool swap = currentRotation & 1;
+      int16_t width  = swap ? matrixHeight : matrixWidth;
+      int16_t height = swap ? matrixWidth  : matrixHeight;
+
+      int16_t x0 = sprite.x < 0 ? 0 : sprite.x;
+      int16_t y0 = sprite.y < 0 ? 0 : sprite.y;
+      int16_t x1 = sprite.x + sprite.w > width  ? width  : sprite.x + sprite.w;
+      int16_t y1 = sprite.y + sprite.h > height ? height : sprite.y + sprite.h;
+      if(x0 < x1 && y0 < y1) markDirty(x0, y0, x1 - x0, y1 - y0);
+    }
+
+    // Blends the sprites over the back buffer within the dirty rect and
+    // writes the result to the bus. The blending is done on the bytes of
+    // the pixels, so it doesn't depend on the channel order.
+    void composeDirtyRect() {
+      bool swap = currentRotation & 1;
+      int16_t width  = swap ? matrixHeight : matrixWidth;
+      int16_t height = swap ? matrixWidth  : matrixHeight;
+
+      int16_t x0 = dirtyX0 < 0 ? 0 : dirtyX0;
+      int16_t y0 = dirtyY0 < 0 ? 0 : dirtyY0;
+      int16_t x1 = dirtyX1 > width  ? width  : dirtyX1;
+      int16_t y1 = dirtyY1 > height ? height : dirtyY1;
+
+      // the visible sprites from bottom to top
+      uint8_t order[NEOGFX_SPRITE_COUNT];
+      uint8_t count = 0;
+      for(uint8_t id=0; id<NEOGFX_SPRITE_COUNT; id++) {
+        const Sprite& sprite = sprites[id];
+        if(!sprite.pixels || !sprite.visible || !sprite.alpha) continue;
+
+        uint8_t n = count++;
+        for(; n > 0 && sprites[order[n - 1]].z > sprite.z; n--) {
+          order[n] = order[n - 1];
+        }
+        order[n] = id;
+      }
+
+      uint8_t pixel[T_COLOR_FEATURE::PixelSize];
+      uint8_t top[T_COLOR_FEATURE::PixelSize];
+
+      for(int16_t y = y0; y < y1; y++) {
+        for(int16_t x = x0; x < x1; x++) {
+          NeoGfxIndex index = pixelIndex(x, y, width, currentRotation, matrixWidth, matrixHeight);
+          if(index >= neoPixelBus->PixelCount()) continue;
+
+          memcpy(pixel, pixelAddress(index), sizeof(pixel));
+
+          for(uint8_t n = 0; n < count; n++) {
+            const Sprite& sprite = sprites[order[n]];
+            if(x < sprite.x || y < sprite.y || x >= sprite.x + sprite.w || y >= sprite.y + sprite.h) continue;
+
+            typename T_COLOR_FEATURE::ColorObject c = sprite.pixels[(y - sprite.y) * sprite.w + (x - sprite.x)];
+            if(sprite.keyed && c == sprite.key) continue;
+
+            T_COLOR_FEATURE::applyPixelColor(top, 0, c);
+            for(uint8_t i=0; i<sizeof(pixel); i++) {
+              pixel[i] += ((int32_t)top[i] - pixel[i]) * (sprite.alpha + 1) >> 8;
+            }
+          }
+          outputPixel((T_NEO_PIXEL_BUS*) neoPixelBus, index, pixel);
+        }
+      }
+    }
+
+    // Writes the bytes of a composed pixel to the bus, through the output
+    // table if there is one.
+    void outputPixel(NeoPixelBus<T_COLOR_FEATURE, T_METHOD>* bus, NeoGfxIndex index, const uint8_t* pixel) {
+      uint8_t* out = bus->Pixels() + (size_t)index * T_COLOR_FEATURE::PixelSize;
+
+      if(outputTable) {
+        for(uint8_t i=0; i<T_COLOR_FEATURE::PixelSize; i++) {
+          out[i] = outputTable[256 * i + pixel[i]];
+        }
+      } else {
+        limitPixel(out, pixel);
+      }
+    }
+
+    template<typename T_BUS>
+    void outputPixel(T_BUS* bus, NeoGfxIndex index, const uint8_t* pixel) {
+      if(outputTable) {
+        outputPixel((NeoPixelBus<T_COLOR_FEATURE, T_METHOD>*) bus, index, pixel);
+      } else {
+        uint8_t limited[T_COLOR_FEATURE::PixelSize];
+        limitPixel(limited, pixel);
+        bus->SetPixelColor(index, T_COLOR_FEATURE::retrievePixelColor(limited, 0));
+      }
+    }
+
+    static const uint8_t StreamHeaderSize = 8;
+
+    // Writes n pixels of the current stream packet.
+    void writeStreamPixels(const uint8_t* data, size_t n) {
+      uint8_t flags    = streamHeader[2];
+      uint8_t channels = streamHeader[3];
+      uint32_t offset  = (uint32_t)(streamHeader[4] | (streamHeader[5] << 8)) + streamPixel;
+      uint16_t count   = neoPixelBus->PixelCount();
+
+      streamPixel += n;
+      if(!backBuffer) neoPixelBus->Dirty();
+      markDirty();
+
+      // indexed colors only take the 16-bit indices of 2-channel packets
+      if(indexBuffer && channels != 2) return;
+
+      if(!(flags & NeoGfxStreamRemap) && (flags & NeoGfxStreamWireOrder)) {
+        if(offset >= count) return;
+        if(offset + n > count) n = count - offset;
+
+        if(powerTracking) addPower(pixelAddress(offset), n, false);
+        memcpy(pixelAddress(offset), data, n * T_COLOR_FEATURE::PixelSize);
+        if(powerTracking) addPower(pixelAddress(offset), n, true);
+        return;
+      }
+
+#ifndef NEOGFX_NO_BULK_CONVERT
+      if(!(flags & (NeoGfxStreamRemap | NeoGfxStreamWireOrder)) && channels == 2 && canConvertInBulk() && writesWire((T_NEO_PIXEL_BUS*) neoPixelBus)) {
+        if(offset >= count) return;
+        if(offset + n > count) n = count - offset;
+
+        writeStream565(data, n, offset);
+        return;
+      }
+#endif
+
+      for(size_t i=0; i<n; i++, offset++, data += channels) {
+        NeoGfxIndex index = offset;
+        if(flags & NeoGfxStreamRemap) {
+          if(offset >= (uint32_t)matrixWidth * matrixHeight) return;
+
+          index = remapTable && currentRotation == 0 ? remapTable[offset] : mapPixel(offset % matrixWidth, offset / matrixWidth);
+        }
+        if(index >= count) continue;
+
+        if(flags & NeoGfxStreamWireOrder) {
+          if(powerTracking) trackPower(pixelAddress(index), data);
+          memcpy(pixelAddress(index), data, T_COLOR_FEATURE::PixelSize);
+        } else if(channels == 2) {
+          setPixel(index, convertColor(data[0] | (data[1] << 8)));
+        } else {
+          setPixel(index, streamColor(data, channels, (typename T_COLOR_FEATURE::ColorObject*) NULL));
+        }
+      }
+    }
+
+#ifndef NEOGFX_NO_BULK_CONVERT
+    // Converts n 565 colors (little endian) of a stream straight into the
+    // pixels starting at offset.
+    void writeStream565(const uint8_t* data, size_t n, NeoGfxIndex offset) {
+      uint16_t colors[NEOGFX_CONVERT_CHUNK];
+
+      while(n > 0) {
+        uint16_t chunk = n < NEOGFX_CONVERT_CHUNK ? n : NEOGFX_CONVERT_CHUNK;
+        for(uint16_t i=0; i<chunk; i++, data += 2) {
+          colors[i] = data[0] | (data[1] << 8);
+        }
+
+        if(powerTracking) addPower(pixelAddress(offset), chunk, false);
+        neoGfxConvert565(wireFormat, colors, pixelAddress(offset), chunk);
+        if(powerTracking) addPower(pixelAddress(offset), chunk, true);
+        offset += chunk;
+        n -= chunk;
+      }
+    }
+#endif
+
+    static RgbColor streamColor(const uint8_t* data, uint8_t, RgbColor*) {
+      return RgbColor(data[0], data[1], data[2]);
+    }
+
+    static RgbwColor streamColor(const uint8_t* data, uint8_t channels, RgbwColor*) {
+      return RgbwColor(data[0], data[1], data[2], channels > 3 ? data[3] : 0);
+    }
+
+    static void swapCoordinates(int16_t& a, int16_t& b) {
+      int16_t t = a;
+      a = b;
+      b = t;
+    }
+
+    // Calculates the visible part [i0, i1) x [j0, j1) of a w x h bitmap at
+    // x/y. Returns false if nothing is visible.
+    bool clipBitmap(int16_t x, int16_t y, int16_t w, int16_t h, int16_t& i0, int16_t& j0, int16_t& i1, int16_t& j1, uint16_t _width, uint16_t _height) {
+      i0 = x < clipX0 ? clipX0 - x : 0;
+      j0 = y < clipY0 ? clipY0 - y : 0;
+      i1 = x + w > (int16_t)_width  ? _width  - x : w;
+      j1 = y + h > (int16_t)_height ? _height - y : h;
+      if(x + i1 > clipX1) i1 = clipX1 - x;
+      if(y + j1 > clipY1) j1 = clipY1 - y;
+
+      bool visible = (i0 < i1) && (j0 < j1);
+      NEOGFX_COUNT(clippedPixels, (int32_t)w * h - (visible ? (int32_t)(i1 - i0) * (j1 - j0) : 0));
+      return visible;
+    }
+
+    // A cached glyph, followed by its 1-bit bitmap (rows padded to bytes
+    // like the bitmaps of drawBitmap). x/y is the offset of the bitmap to
+    // the cursor, w/h its size in pixels (text size applied).
+    struct Glyph {
+      const GFXfont* font;
+      uint16_t next;
+      int16_t x, y, w, h;
+      unsigned char c;
+      uint8_t sizeX, sizeY;
+    };
+
+    // A band of renderBands and the dirty rect it left.
+    struct Band {
+      NeoGfx* canvas;
+      void (*fn)(Adafruit_GFX& gfx, int16_t y, int16_t h);
+      uint8_t rotation;
+      int16_t y, h;
+      bool dirty;
+      int16_t dirtyX, dirtyY, dirtyW, dirtyH;
+      uint32_t power[T_COLOR_FEATURE::PixelSize];
+    };
+
+    static void renderBand(void* arg, uint8_t index) {
+      Band& b = ((Band*) arg)[index];
+      NeoGfx& canvas = *b.canvas;
+
+      NeoGfxBand<NeoGfx> gfx(canvas, canvas.neoPixelBus, canvas.matrixWidth, canvas.matrixHeight, b.rotation, b.y, b.h);
+      (*b.fn)(gfx, b.y, b.h);
+      b.dirty = gfx.getDirtyRect(b.dirtyX, b.dirtyY, b.dirtyW, b.dirtyH);
+      gfx.getPowerSums(b.power);
+    }
+
+    static const uint16_t NoGlyph = 0xFFFF;
+    static const uint8_t GlyphBuckets = 32;
+
+    // Draws the glyph of c (w x h font pixels at xOffset/yOffset) at the
+    // cursor. Glyphs which are not cached yet are rasterized by drawing
+    // them with gfx->drawChar while the drawn pixels are captured.
+    template<typename T_COLOR>
+    void drawGlyph(Adafruit_GFX* gfx, const GFXfont* font, int16_t x, int16_t y, unsigned char c, int8_t xOffset, int8_t yOffset, uint8_t w, uint8_t h, T_COLOR color, T_COLOR bg, uint8_t sizeX, uint8_t sizeY, uint16_t _width, uint16_t _height,  uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      Glyph* glyph = findGlyph(font, c, sizeX, sizeY);
+      if(!glyph) {
+        glyph = addGlyph(font, c, xOffset * sizeX, yOffset * sizeY, w * sizeX, h * sizeY, sizeX, sizeY);
+        if(!glyph) {
+          drawUncachedGlyph(gfx, font, x, y, c, xOffset, yOffset, w, h, color, bg, sizeX, sizeY, _width, _height, rotation, WIDTH, HEIGHT);
+          return;
+        }
+        captureGlyph(gfx, glyph);
+      }
+      drawGlyphBitmap(x, y, glyph, color, bg, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    template<typename T_COLOR>
+    void drawGlyphBitmap(int16_t x, int16_t y, const Glyph* glyph, T_COLOR color, T_COLOR bg, uint16_t _width, uint16_t _height,  uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      // like Adafruit_GFX the background is drawn if it differs from color
+      drawBitmap(x + glyph->x, y + glyph->y, (const uint8_t*)(glyph + 1), false, glyph->w, glyph->h, color, bg == color ? NULL : &bg, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void captureGlyph(Adafruit_GFX* gfx, Glyph* glyph) {
+      glyphCapture = glyph;
+      gfx->drawChar(0, 0, glyph->c, 0xFFFF, 0xFFFF, glyph->sizeX, glyph->sizeY);
+      glyphCapture = NULL;
+    }
+
+    void drawUncachedGlyph(Adafruit_GFX* gfx, const GFXfont*, int16_t x, int16_t y, unsigned char c, int8_t, int8_t, uint8_t, uint8_t, uint16_t color, uint16_t bg, uint8_t sizeX, uint8_t sizeY, uint16_t, uint16_t,  uint8_t, int16_t, int16_t) {
+      gfx->drawChar(x, y, c, color, bg, sizeX, sizeY);
+    }
+
+    // Native colors can't be passed to drawChar, so the glyph is captured
+    // into a temporary buffer.
+    void drawUncachedGlyph(Adafruit_GFX* gfx, const GFXfont* font, int16_t x, int16_t y, unsigned char c, int8_t xOffset, int8_t yOffset, uint8_t w, uint8_t h, typename T_COLOR_FEATURE::ColorObject color, typename T_COLOR_FEATURE::ColorObject bg, uint8_t sizeX, uint8_t sizeY, uint16_t _width, uint16_t _height,  uint8_t rotation, int16_t WIDTH, int16_t HEIGHT) {
+      Glyph* glyph = (Glyph*) malloc(sizeof(Glyph) + glyphBytes(w * sizeX, h * sizeY));
+      if(!glyph) return;
+
+      initGlyph(glyph, font, c, xOffset * sizeX, yOffset * sizeY, w * sizeX, h * sizeY, sizeX, sizeY);
+      captureGlyph(gfx, glyph);
+      drawGlyphBitmap(x, y, glyph, color, bg, _width, _height, rotation, WIDTH, HEIGHT);
+      free(glyph);
+    }
+
+    Glyph* findGlyph(const GFXfont* font, unsigned char c, uint8_t sizeX, uint8_t sizeY) {
+      if(!glyphCache) return NULL;
+
+      for(uint16_t i = glyphBuckets[c % GlyphBuckets]; i != NoGlyph; ) {
+        Glyph* glyph = (Glyph*)(glyphCache + i);
+        if(glyph->c == c && glyph->font == font && glyph->sizeX == sizeX && glyph->sizeY == sizeY) return glyph;
+        i = glyph->next;
+      }
+      return NULL;
+    }
+
+    // Reserves an empty glyph. Returns NULL if it doesn't fit into the
+    // cache at all.
+    Glyph* addGlyph(const GFXfont* font, unsigned char c, int16_t x, int16_t y, int16_t w, int16_t h, uint8_t sizeX, uint8_t sizeY) {
+      if(!glyphCache) return NULL;
+
+      size_t size = (sizeof(Glyph) + glyphBytes(w, h) + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+      if(size > glyphCacheSize) return NULL;
+      if(glyphCacheUsed + size > glyphCacheSize) clearGlyphCache();
+
+      Glyph* glyph = (Glyph*)(glyphCache + glyphCacheUsed);
+      initGlyph(glyph, font, c, x, y, w, h, sizeX, sizeY);
+
+      glyph->next = glyphBuckets[c % GlyphBuckets];
+      glyphBuckets[c % GlyphBuckets] = glyphCacheUsed;
+      glyphCacheUsed += size;
+      return glyph;
+    }
+
+    static size_t glyphBytes(int16_t w, int16_t h) {
+      return ((w + 7) / 8) * (size_t)h;
+    }
+
+    // Fills in an empty glyph (the bitmap cleared).
+    static void initGlyph(Glyph* glyph, const GFXfont* font, unsigned char c, int16_t x, int16_t y, int16_t w, int16_t h, uint8_t sizeX, uint8_t sizeY) {
+      glyph->font  = font;
+      glyph->c     = c;
+      glyph->x     = x;
+      glyph->y     = y;
+      glyph->w     = w;
+      glyph->h     = h;
+      glyph->sizeX = sizeX;
+      glyph->sizeY = sizeY;
+      memset(glyph + 1, 0, glyphBytes(w, h));
+    }
+
+    // Sets the bits of a rect drawn while a glyph is rasterized.
+    void captureRect(int16_t x, int16_t y, int16_t w, int16_t h) {
+      Glyph* glyph = glyphCapture;
+      uint8_t* bits = (uint8_t*)(glyph + 1);
+      int16_t byteWidth = (glyph->w + 7) / 8;
+
+      x -= glyph->x;
+      y -= glyph->y;
+      for(int16_t j = y < 0 ? 0 : y; j < y + h && j < glyph->h; j++) {
+        for(int16_t i = x < 0 ? 0 : x; i < x + w && i < glyph->w; i++) {
+          bits[j * byteWidth + i / 8] |= 0x80 >> (i & 7);
+        }
+      }
+    }
+
+    // Maps an unrotated x/y position to the index of the pixel on the bus.
+    NeoGfxIndex mapPixel(int16_t x, int16_t y) {
+      NEOGFX_COUNT(remapCalls, 1);
+      return mapPixel(x, y, (T_LAYOUT*) NULL);
+    }
+
+    template<typename T_STATIC_LAYOUT>
+    NeoGfxIndex mapPixel(int16_t x, int16_t y, T_STATIC_LAYOUT*) {
+      return T_STATIC_LAYOUT::Map(matrixWidth, matrixHeight, x, y);
+    }
+
+    NeoGfxIndex mapPixel(int16_t x, int16_t y, NeoGfxRemapLayout*) {
+      NeoGfxIndex tileOffset = 0;
+      NeoGfxIndex pixelOffset = 0;
+
+      if(remapTable_P) { // Precomputed table in PROGMEM
+#ifdef NEOGFX_LARGE_MATRIX
+        memcpy_P(&pixelOffset, &remapTable_P[(NeoGfxIndex)y * matrixWidth + x], sizeof(pixelOffset));
+#else
+        pixelOffset = pgm_read_word(&remapTable_P[(NeoGfxIndex)y * matrixWidth + x]);
+#endif
+      } else if(remapFn) { // Custom X/Y remapping function
+        pixelOffset = (*remapFn)(x, y);
+      }
+#ifdef NEOGFX_LARGE_MATRIX
+      else if(remapFn16) {
+        pixelOffset = (*remapFn16)(x, y);
+      }
+#endif
+
+      return tileOffset + pixelOffset;
+    }
+
+    // Converts a 16-bit color to the color of the feature. Adafruit_GFX
+    // primitives mostly use only a few colors, so the last conversions are
+    // cached.
+    typename T_COLOR_FEATURE::ColorObject convertColor(uint16_t color) {
+      if(indexBuffer)  return indexColor(color);
+      if(passThruFlag) return passThruColor;
+      if(colorTable)   return colorTable[color];
+
+      for(uint8_t i=0; i<NEOGFX_COLOR_CACHE_SIZE; i++) {
+        if(colorCacheKey[i] == color) return colorCacheValue[i];
+      }
+
+      uint8_t i = colorCacheNext;
+      colorCacheNext = (i + 1) % NEOGFX_COLOR_CACHE_SIZE;
+
+      NEOGFX_COUNT(colorConversions, 1);
+      colorCacheKey[i]   = color;
+      colorCacheValue[i] = expandToFeature(color);
+      return colorCacheValue[i];
+    }
+
+    // With the output table the gamma correction is done on output.
+    typename T_COLOR_FEATURE::ColorObject expandToFeature(uint16_t color) {
+      return outputTable ? expandLinearColorObject(color) : expandColorObject(color);
+    }
+
+    // Drops the converted colors after the conversion changed.
+    void resetColorCache() {
+      for(uint8_t i=0; i<NEOGFX_COLOR_CACHE_SIZE; i++) {
+        colorCacheKey[i]   = 0;
+        colorCacheValue[i] = expandToFeature(0);
+      }
+      colorCacheNext = 0;
+
+#ifndef NEOGFX_NO_BULK_CONVERT
+      for(uint8_t level=0; level<64; level++) {
+        if(level < 32) {
+          wireFormat.red[level]  = outputTable ? (level << 3) | (level >> 2) : T_GAMMA::red5(level);
+          wireFormat.blue[level] = outputTable ? (level << 3) | (level >> 2) : T_GAMMA::blue5(level);
+        }
+        wireFormat.green[level] = outputTable ? (level << 2) | (level >> 4) : T_GAMMA::green6(level);
+      }
+#endif
+
+      if(colorTable) {
+        for(uint32_t color=0; color<65536UL; color++) {
+          colorTable[color] = expandToFeature(color);
+        }
+      }
+    }
+
+    // Fills a rect given in unrotated coordinates. It has to be already
+    // clipped to the matrix. Returns true if a pixel changed.
+    bool fillRawRect(int16_t x, int16_t y, int16_t w, int16_t h, typename T_COLOR_FEATURE::ColorObject c) {
+      bool changed = false;
+
+      for(int16_t row = y; row < y + h; row++) {
+        NeoGfxIndex first = mapPixel(x, row);
+        NeoGfxIndex last  = first;
+        int8_t   dir   = 0;
+
+        for(int16_t col = x + 1; col < x + w; col++) {
+          changed |= nextIndex(mapPixel(col, row), first, last, dir, c);
+        }
+        changed |= writeRun(first, last, c);
+      }
+      return changed;
+    }
+
+    // Writes count pixels given by their index, merging neighbours to runs.
+    bool writeIndices(const NeoGfxIndex* indices, int16_t count, typename T_COLOR_FEATURE::ColorObject c) {
+      bool changed = false;
+      NeoGfxIndex first = indices[0];
+      NeoGfxIndex last  = first;
+      int8_t   dir   = 0;
+
+      for(int16_t n = 1; n < count; n++) {
+        changed |= nextIndex(indices[n], first, last, dir, c);
+      }
+      return writeRun(first, last, c) || changed;
+    }
+
+    // Extends the current run [first, last] by i if it is the next pixel in
+    // the run's direction, otherwise writes the run and starts a new one.
+    bool nextIndex(NeoGfxIndex i, NeoGfxIndex& first, NeoGfxIndex& last, int8_t& dir, typename T_COLOR_FEATURE::ColorObject c) {
+      bool changed = false;
+
+      if(dir >= 0 && i == last + 1) {
+        dir = 1;
+      } else if(dir <= 0 && i + 1 == last) {
+        dir = -1;
+      } else {
+        changed = writeRun(first, last, c);
+        first = i;
+        dir   = 0;
+      }
+      last = i;
+      return changed;
+    }
+
+    // Writes the first pixel through the bus (which applies e.g. the
+    // brightness) and copies its bytes to the rest of the run, skipping
+    // pixels which already have the value. The part of the run beyond the
+    // bus is dropped. Returns true if a pixel changed.
+    bool writeRun(NeoGfxIndex first, NeoGfxIndex last, typename T_COLOR_FEATURE::ColorObject c) {
+      if(first > last) {
+        NeoGfxIndex t = first;
+        first = last;
+        last  = t;
+      }
+      if(first >= neoPixelBus->PixelCount()) return false;
+      if(last >= neoPixelBus->PixelCount()) last = neoPixelBus->PixelCount() - 1;
+
+      NEOGFX_COUNT(spanWrites, 1);
+      if(indexBuffer) {
+        bool changed = false;
+        for(NeoGfxIndex i = first; i <= last; i++) {
+          changed |= setColorIndex(i, c.R);
+        }
+        return changed;
+      }
+      bool changed = setPixel(first, c);
+      const uint8_t* value = pixelAddress(first);
+      const uint8_t* end = pixelAddress(last);
+
+      for(uint8_t* pixel = pixelAddress(first + 1); pixel <= end; pixel += T_COLOR_FEATURE::PixelSize) {
+        if(memcmp(pixel, value, T_COLOR_FEATURE::PixelSize) != 0) {
+          if(powerTracking) trackPower(pixel, value);
+          memcpy(pixel, value, T_COLOR_FEATURE::PixelSize);
+          changed = true;
+        }
+      }
+      return changed;
+    }
+
+    const NeoGfxDim matrixWidth, matrixHeight;
+    NeoGfxIndex (*remapFn)(uint16_t x, uint16_t y);
+#ifdef NEOGFX_LARGE_MATRIX
+    uint16_t (*remapFn16)(uint16_t x, uint16_t y) = NULL;
+#endif
+    const NeoGfxIndex* remapTable_P;
+
+    NeoGfxIndex* remapTable = NULL;
+    bool sharedBuffers = false;
+
+    int16_t clipX0 = 0, clipY0 = 0;
+    int16_t clipX1 = 0x7FFF, clipY1 = 0x7FFF;
+    uint8_t currentRotation = 0;
+
+    uint8_t* backBuffer = NULL;
+    uint8_t* outputTable = NULL;
+    uint8_t outputBrightness = 255;
+
+#ifndef NEOGFX_NO_BULK_CONVERT
+    NeoGfxWireFormat wireFormat;
+#endif
+
+    uint8_t* indexBuffer = NULL;
+    uint8_t* palette = NULL;
+    uint8_t indexBits = 0;
+
+    bool powerTracking = false;
+    uint32_t powerSums[T_COLOR_FEATURE::PixelSize] = {};
+    NeoGfxPowerModel powerModel;
+    uint8_t powerChannel[T_COLOR_FEATURE::PixelSize] = {};
+    uint8_t powerBlack[T_COLOR_FEATURE::PixelSize] = {};
+    uint8_t powerRange[T_COLOR_FEATURE::PixelSize] = {};
+    uint32_t powerLimit = 0;
+    uint8_t limitBrightness = 255;
+
+    bool dirty = false;
+    int16_t dirtyX0, dirtyY0, dirtyX1, dirtyY1;
+
+    typename T_COLOR_FEATURE::ColorObject passThruColor;
+    bool passThruFlag = false;
+
+    typename T_COLOR_FEATURE::ColorObject nativeTextFg, nativeTextBg;
+    bool nativeTextFlag = false;
+
+    uint16_t colorCacheKey[NEOGFX_COLOR_CACHE_SIZE];
+    typename T_COLOR_FEATURE::ColorObject colorCacheValue[NEOGFX_COLOR_CACHE_SIZE];
+    uint8_t colorCacheNext = 0;
+    typename T_COLOR_FEATURE::ColorObject* colorTable = NULL;
+
+    uint8_t* glyphCache = NULL;
+    uint16_t glyphCacheSize = 0;
+    uint16_t glyphCacheUsed = 0;
+    uint16_t glyphBuckets[GlyphBuckets];
+    Glyph* glyphCapture = NULL;
+
+    Sprite sprites[NEOGFX_SPRITE_COUNT] = {};
+    uint8_t spriteCount = 0;
+
+    uint8_t streamHeader[StreamHeaderSize];
+    uint8_t streamHeaderLength = 0;
+    uint16_t streamPixel = 0;
+    uint8_t streamPart[4];
+    uint8_t streamPartLength = 0;
+
+    void (*renderFn)(uint32_t deltaMicros) = NULL;
+    uint32_t frameInterval = 0;
+    uint32_t nextFrame = 0;
+    uint32_t lastFrame = 0;
+    bool frameStarted = false;
+    uint32_t fpsStart = 0;
+    uint16_t fpsFrames = 0;
+    NeoGfxFrameStats frameStats = NeoGfxFrameStats();
+
+#ifdef NEOGFX_STATS
+    class DrawScope {
+     public:
+      DrawScope(NeoGfx* neoGfx) : gfx(neoGfx) { gfx->beginDraw(); }
+      ~DrawScope() { gfx->endDraw(); }
+     private:
+      NeoGfx* gfx;
+    };
+
+    NeoGfxStats stats = NeoGfxStats();
+    void (*frameCallback)(const NeoGfxStats& stats) = NULL;
+    uint8_t drawDepth = 0;
+    unsigned long drawStart;
+#endif
 
     NeoPixelBus<T_COLOR_FEATURE, T_METHOD>* neoPixelBus;
 };
@@ -0,0 +1,267 @@
+/*--------------------------------------------------------------------
+  NeoPixelBusGfx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation, either version 3 of
+  the License, or (at your option) any later version.
+
+  NeoPixelBusGfx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with NeoPixelBusGfx.  If not, see
+  <http://www.gnu.org/licenses/>.
+  --------------------------------------------------------------------*/
+
+#ifndef _ADAFRUIT_NEOGFXANIMATION_H_
+#define _ADAFRUIT_NEOGFXANIMATION_H_
+
+#if ARDUINO >= 100
+ #include <Arduino.h>
+#elif defined(ARDUINO)
+ #include <WProgram.h>
+ #include <pins_arduino.h>
+#else
+ // Outside of Arduino (e.g. a build on the host) the Adafruit_GFX.h and
+ // NeoPixelBus.h on the include path have to provide the Arduino types.
+ #include <stdint.h>
+ #include <stdlib.h>
+ #include <string.h>
+#endif
+
+#ifdef __AVR__
+ #include <avr/pgmspace.h>
+#elif defined(ESP8266)
+ #include <pgmspace.h>
+#else
+ #ifndef pgm_read_byte
+  #define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+ #endif
+#endif
+
+// Compressed animations of 16-bit (565) colors, created with
+// tools/neogfx_anim.py. All numbers are little endian:
+//
+//   'N' 'A' version(1) width(2) height(2) frames(2) paletteSize(2)
+//   palette: paletteSize colors(2)
+//   per frame: flags(1) delay in ms(2) length of the commands(2) commands
+//
+// The commands walk over the pixels of the frame row by row:
+//   0x00 - 0x3F  skip n + 1 pixels, they keep the color of the last frame
+//   0x40 - 0x7F  n - 0x40 + 1 pixels of the next color
+//   0x80 - 0xFF  n - 0x80 + 1 pixels with a color each
+// A color is a palette index(1) if there is a palette, otherwise a 565
+// color(2). Keyframes (flags bit 0) contain no skips. The first frame is
+// always a keyframe.
+
+// Number of colors decoded at once before they are drawn.
+#ifndef NEOGFX_ANIMATION_ROW
+ #define NEOGFX_ANIMATION_ROW 32
+#endif
+
+// Reads an animation stored in PROGMEM.
+class NeoGfxProgmemReader {
+
+ public:
+    NeoGfxProgmemReader(const uint8_t* animation) :
+      data(animation), position(0)
+    {
+    }
+
+    uint8_t read() {
+      return pgm_read_byte(&data[position++]);
+    }
+
+    void seek(uint32_t pos) {
+      position = pos;
+    }
+
+    uint32_t tell() const {
+      return position;
+    }
+
+ protected:
+    const uint8_t* data;
+    uint32_t position;
+};
+
+// Reads an animation from a file (e.g. a File of SD or LittleFS), which
+// has to stay open while the animation is played.
+template<typename T_FILE>
+class NeoGfxFileReader {
+
+ public:
+    NeoGfxFileReader(T_FILE& animationFile) :
+      file(animationFile)
+    {
+    }
+
+    uint8_t read() {
+      int b = file.read();
+      return b < 0 ? 0 : b;
+    }
+
+    void seek(uint32_t pos) {
+      file.seek(pos);
+    }
+
+    uint32_t tell() {
+      return file.position();
+    }
+
+ protected:
+    T_FILE& file;
+};
+
+// Decodes an animation frame by frame. Only the pixels which change are
+// drawn, runs of one color with writeFastHLine and other pixels as rows of
+// drawRGBBitmap, so the wrappers' span and bitmap paths are used. Delta
+// frames expect the last frame to be still on the matrix.
+// T_READER is NeoGfxProgmemReader, NeoGfxFileReader or any class with
+// uint8_t read(), seek(uint32_t) and tell().
+template<typename T_READER>
+class NeoGfxAnimation {
+
+ public:
+    // source is passed to the constructor of the reader, e.g. the array
+    // in PROGMEM or the File.
+    template<typename T_SOURCE>
+    NeoGfxAnimation(T_SOURCE& source) :
+      reader(source)
+    {
+    }
+
+    ~NeoGfxAnimation() {
+      free(palette);
+    }
+
+    // Reads the header. Returns false if it is no animation or there is
+    // not enough memory for the palette.
+    bool begin() {
+      reader.seek(0);
+      if(reader.read() != 'N' || reader.read() != 'A' || reader.read() != 1) return false;
+
+      width      = read16();
+      height     = read16();
+      frameCount = read16();
+
+      free(palette);
+      palette = NULL;
+      paletteSize = read16();
+      if(paletteSize) {
+        palette = (uint16_t*) malloc(sizeof(uint16_t) * paletteSize);
+        if(!palette) return false;
+
+        for(uint16_t i=0; i<paletteSize; i++) {
+          palette[i] = read16();
+        }
+      }
+
+      firstFrame = reader.tell();
+      frame = 0;
+      return frameCount > 0;
+    }
+
+    uint16_t getWidth() const {
+      return width;
+    }
+
+    uint16_t getHeight() const {
+      return height;
+    }
+
+    uint16_t getFrameCount() const {
+      return frameCount;
+    }
+
+    // The number of the frame drawn next, 0 again after the last frame.
+    uint16_t getFrame() const {
+      return frame < frameCount ? frame : 0;
+    }
+
+    // Starts again with the first frame.
+    void rewind() {
+      reader.seek(firstFrame);
+      frame = 0;
+    }
+
+    // Draws the next frame at x/y and returns how long it should be shown
+    // (in ms). After the last frame the animation starts over.
+    template<typename T_GFX>
+    uint16_t drawFrame(T_GFX& gfx, int16_t x, int16_t y) {
+      if(frame >= frameCount) rewind();
+
+      reader.read(); // flags
+      uint16_t frameDelay = read16();
+      uint16_t length     = read16();
+      uint32_t end        = reader.tell() + length;
+
+      uint32_t pixel = 0;
+      uint32_t count = (uint32_t)width * height;
+      while(pixel < count && reader.tell() < end) {
+        uint8_t command = reader.read();
+        uint8_t n = (command & (command & 0x80 ? 0x7F : 0x3F)) + 1;
+
+        if(command < 0x40) {
+          pixel += n;
+        } else if(command < 0x80) {
+          uint16_t color = readColor();
+          while(n > 0 && pixel < count) {
+            uint8_t run = rowRun(pixel, n, 0xFF);
+            gfx.writeFastHLine(x + pixel % width, y + pixel / width, run, color);
+            pixel += run;
+            n -= run;
+          }
+        } else {
+          while(n > 0 && pixel < count) {
+            uint8_t run = rowRun(pixel, n, NEOGFX_ANIMATION_ROW);
+            for(uint8_t i=0; i<run; i++) {
+              row[i] = readColor();
+            }
+            gfx.drawRGBBitmap(x + pixel % width, y + pixel / width, row, run, 1);
+            pixel += run;
+            n -= run;
+          }
+        }
+      }
+
+      reader.seek(end);
+      frame++;
+      return frameDelay;
+    }
+
+ protected:
+    uint16_t read16() {
+      uint16_t low = reader.read();
+      return low | (reader.read() << 8);
+    }
+
+    uint16_t readColor() {
+      if(!palette) return read16();
+
+      uint8_t index = reader.read();
+      return index < paletteSize ? palette[index] : 0;
+    }
+
+    // The part of n pixels starting at pixel which is within its row,
+    // at most limit pixels.
+    uint8_t rowRun(uint32_t pixel, uint8_t n, uint8_t limit) {
+      uint16_t left = width - pixel % width;
+      if(left > limit) left = limit;
+      return n < left ? n : left;
+    }
+
+    T_READER reader;
+    uint16_t width = 0, height = 0;
+    uint16_t frameCount = 0;
+    uint16_t frame = 0;
+    uint32_t firstFrame = 0;
+
+    uint16_t* palette = NULL;
+    uint16_t paletteSize = 0;
+
+    uint16_t row[NEOGFX_ANIMATION_ROW];
+};
+
+#endif // _ADAFRUIT_NEOGFXANIMATION_H_
@@ -0,0 +1,209 @@
+/*--------------------------------------------------------------------
+  NeoPixelBusGfx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation, either version 3 of
+  the License, or (at your option) any later version.
+
+  NeoPixelBusGfx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with NeoPixelBusGfx.  If not, see
+  <http://www.gnu.org/licenses/>.
+  --------------------------------------------------------------------*/
+
+#ifndef _ADAFRUIT_NEOGFXBANDS_H_
+#define _ADAFRUIT_NEOGFXBANDS_H_
+
+// The parts of NeoGfx::renderBands which don't depend on the NeoGfx:
+// running the bands on the cores, and the Adafruit_GFX handed to the
+// render function of a band.
+
+#include <Adafruit_GFX.h>
+
+// Maximum number of bands of renderBands.
+#ifndef NEOGFX_MAX_BANDS
+ #define NEOGFX_MAX_BANDS 8
+#endif
+
+// Stack of the tasks running the bands on the ESP32.
+#ifndef NEOGFX_BAND_STACK
+ #define NEOGFX_BAND_STACK 4096
+#endif
+
+// The bands run in parallel on the ESP32 (FreeRTOS tasks) and on the host
+// (std::thread). Everywhere else, or with NEOGFX_NO_THREADS defined, they
+// run one after the other.
+#if defined(NEOGFX_NO_THREADS)
+#elif defined(ESP32)
+ #include <freertos/FreeRTOS.h>
+ #include <freertos/task.h>
+ #include <freertos/semphr.h>
+ #define NEOGFX_FREERTOS_BANDS
+#elif !defined(ARDUINO)
+ #include <thread>
+ #define NEOGFX_STD_THREAD_BANDS
+#endif
+
+// Work of one core: the bands first, first + step, first + 2 * step ...
+struct NeoGfxBandWorker {
+    void (*job)(void* arg, uint8_t band);
+    void* arg;
+    uint8_t first, step, count;
+#ifdef NEOGFX_FREERTOS_BANDS
+    SemaphoreHandle_t done;
+#endif
+
+    void run() {
+      for(uint8_t band = first; band < count; band += step) {
+        (*job)(arg, band);
+      }
+    }
+};
+
+#ifdef NEOGFX_FREERTOS_BANDS
+inline void neoGfxBandTask(void* worker) {
+  NeoGfxBandWorker* w = (NeoGfxBandWorker*) worker;
+  w->run();
+  xSemaphoreGive(w->done);
+  vTaskDelete(NULL);
+}
+#endif
+
+// Calls job(arg, band) for the bands 0 to count - 1, spread over the
+// cores. The calling task takes its share too and returns when all bands
+// are done.
+inline void neoGfxParallelFor(uint8_t count, void (*job)(void* arg, uint8_t band), void* arg) {
+#if defined(NEOGFX_FREERTOS_BANDS)
+  uint8_t workers = count < portNUM_PROCESSORS ? count : portNUM_PROCESSORS;
+#elif defined(NEOGFX_STD_THREAD_BANDS)
+  unsigned cores = std::thread::hardware_concurrency();
+  uint8_t workers = cores == 0 ? 1 : (count < cores ? count : cores);
+#else
+  uint8_t workers = 1;
+#endif
+  if(workers < 1) workers = 1;
+
+  NeoGfxBandWorker worker[NEOGFX_MAX_BANDS];
+  for(uint8_t i=0; i<workers; i++) {
+    worker[i].job   = job;
+    worker[i].arg   = arg;
+    worker[i].first = i;
+    worker[i].step  = workers;
+    worker[i].count = count;
+  }
+
+#if defined(NEOGFX_FREERTOS_BANDS)
+  SemaphoreHandle_t done = workers > 1 ? xSemaphoreCreateCounting(workers, 0) : NULL;
+  uint8_t started = 0;
+  for(uint8_t i=1; i<workers; i++) {
+    worker[i].done = done;
+    BaseType_t core = (xPortGetCoreID() + i) % portNUM_PROCESSORS;
+    if(done && xTaskCreatePinnedToCore(neoGfxBandTask, "neogfx", NEOGFX_BAND_STACK, &worker[i], uxTaskPriorityGet(NULL), NULL, core) == pdPASS) {
+      started++;
+    } else {
+      worker[i].run();
+    }
+  }
+  worker[0].run();
+  while(started > 0) {
+    xSemaphoreTake(done, portMAX_DELAY);
+    started--;
+  }
+  if(done) vSemaphoreDelete(done);
+#elif defined(NEOGFX_STD_THREAD_BANDS)
+  std::thread threads[NEOGFX_MAX_BANDS];
+  for(uint8_t i=1; i<workers; i++) {
+    threads[i] = std::thread(&NeoGfxBandWorker::run, &worker[i]);
+  }
+  worker[0].run();
+  for(uint8_t i=1; i<workers; i++) {
+    threads[i].join();
+  }
+#else
+  worker[0].run();
+#endif
+}
+
+// The Adafruit_GFX passed to the render function of a band. It draws with
+// its own NeoGfx, which shares the buffers of the canvas and is clipped to
+// the rows of the band, so the bands neither write the same pixels nor
+// share a color cache or dirty rect.
+template<typename T_NEO_GFX>
+class NeoGfxBand : public Adafruit_GFX {
+
+ public:
+    template<typename T_BUS>
+    NeoGfxBand(const T_NEO_GFX& canvas, T_BUS* bus, int16_t w, int16_t h, uint8_t r, int16_t y, int16_t bandHeight) :
+      Adafruit_GFX(w, h),
+      view(w, h, bus)
+    {
+      Adafruit_GFX::setRotation(r);
+      view.shareBuffers(canvas);
+      view.setClipRect(0, y, _width, bandHeight);
+    }
+
+    // The rotation is the one of the canvas.
+    void setRotation(uint8_t) {
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) {
+      view.drawPixel(x, y, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void writePixel(int16_t x, int16_t y, uint16_t color) {
+      view.drawPixel(x, y, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void fillScreen(uint16_t color) {
+      view.fillRect(0, 0, _width, _height, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+      view.writeFastHLine(x, y, w, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+      view.writeFastVLine(x, y, h, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+      view.writeFastHLine(x, y, w, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+      view.writeFastVLine(x, y, h, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+      view.fillRect(x, y, w, h, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+      view.fillRect(x, y, w, h, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    // Text in the native text colors of the canvas, if it has any.
+    size_t write(uint8_t c) {
+      if(view.hasNativeTextColor()) {
+        return view.writeNativeText(this, c, cursor_x, cursor_y, gfxFont, textsize_x, textsize_y, wrap, _width, _height, rotation, WIDTH, HEIGHT);
+      }
+      return Adafruit_GFX::write(c);
+    }
+
+    bool getDirtyRect(int16_t& x, int16_t& y, int16_t& w, int16_t& h) const {
+      return view.getDirtyRect(x, y, w, h);
+    }
+
+    // How the band changed the power sums of the canvas.
+    void getPowerSums(uint32_t* sums) const {
+      view.getPowerSums(sums);
+    }
+
+ protected:
+    T_NEO_GFX view;
+};
+
+#endif // _ADAFRUIT_NEOGFXBANDS_H_
@@ -0,0 +1,263 @@
+/*--------------------------------------------------------------------
+  NeoPixelBusGfx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation, either version 3 of
+  the License, or (at your option) any later version.
+
+  NeoPixelBusGfx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with NeoPixelBusGfx.  If not, see
+  <http://www.gnu.org/licenses/>.
+  --------------------------------------------------------------------*/
+
+#ifndef _ADAFRUIT_NEOGFXCONVERT_H_
+#define _ADAFRUIT_NEOGFXCONVERT_H_
+
+// Bulk conversion of 565 colors to the bytes of a feature, as they are
+// sent on the wire. It is used by NeoGfx for RGB bitmaps and 565 frame
+// streams instead of converting every pixel on its own.
+
+// Number of pixels converted at once (on the stack, up to 6 bytes each).
+#ifndef NEOGFX_CONVERT_CHUNK
+ #define NEOGFX_CONVERT_CHUNK 32
+#endif
+
+// The tables of the conversion cost 136 bytes of RAM per NeoGfx, so it is
+// left out on AVR. Define NEOGFX_NO_BULK_CONVERT to leave it out elsewhere.
+#if defined(__AVR__) && !defined(NEOGFX_NO_BULK_CONVERT)
+ #define NEOGFX_NO_BULK_CONVERT
+#endif
+
+// The kernel converting 16 pixels at once: SSSE3 on the host (build with
+// -mssse3 or -march=native), otherwise 4 pixels at once packed into 32-bit
+// words (e.g. on the ESP32 and ESP8266). Define NEOGFX_NEON_CONVERT to use
+// NEON table lookups on 64-bit ARM instead, it is only checked by the
+// bench_convert_neon benchmark on aarch64 hosts. Define
+// NEOGFX_SCALAR_CONVERT to convert pixel by pixel.
+#if defined(NEOGFX_NEON_CONVERT) && !(defined(__ARM_NEON) && defined(__aarch64__))
+ #undef NEOGFX_NEON_CONVERT
+#endif
+
+#if defined(NEOGFX_NO_BULK_CONVERT) || defined(NEOGFX_SCALAR_CONVERT)
+ #undef NEOGFX_NEON_CONVERT
+#elif defined(__SSSE3__)
+ #include <tmmintrin.h>
+ #define NEOGFX_SSSE3_CONVERT
+#elif defined(NEOGFX_NEON_CONVERT)
+ #include <arm_neon.h>
+#elif defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+ #define NEOGFX_SWAR_CONVERT
+#endif
+
+#ifndef NEOGFX_NO_BULK_CONVERT
+
+// Where the channels of a feature are on the wire, and the gamma tables
+// for the 5 and 6 bit channels of the 565 colors.
+struct NeoGfxWireFormat {
+    uint8_t size;       // bytes per pixel, 0 if the feature can't be converted in bulk
+    uint8_t r, g, b;    // offsets of the channels within a pixel
+    uint8_t fill[4];    // the pixel of black, the other bytes keep their value
+    uint8_t red[32], green[64], blue[32];
+#ifdef NEOGFX_SSSE3_CONVERT
+    // per 16 bytes of output: where they come from in the red, green and
+    // blue of 16 pixels (0x80: nowhere)
+    uint8_t shuffle[4][3][16];
+    uint8_t fillChunk[4][16];
+#endif
+};
+
+// Finds the channels in the bytes written by the feature. Only features
+// with 3 or 4 bytes per pixel, each channel in a byte of its own, can be
+// converted in bulk (e.g. NeoGrbFeature, NeoRgbwFeature, DotStarBgrFeature).
+// Returns false for the others (e.g. 16-bit channels), the size is 0 then.
+template<typename T_COLOR_FEATURE>
+bool neoGfxProbeWireFormat(NeoGfxWireFormat& f) {
+  const uint8_t size = T_COLOR_FEATURE::PixelSize;
+  uint8_t black[size], probe[size], probe2[size];
+  T_COLOR_FEATURE::applyPixelColor(black,  0, typename T_COLOR_FEATURE::ColorObject(RgbColor(0x00, 0x00, 0x00)));
+  T_COLOR_FEATURE::applyPixelColor(probe,  0, typename T_COLOR_FEATURE::ColorObject(RgbColor(0x11, 0x22, 0x33)));
+  T_COLOR_FEATURE::applyPixelColor(probe2, 0, typename T_COLOR_FEATURE::ColorObject(RgbColor(0xEE, 0xDD, 0xCC)));
+
+  f.size = 0;
+  f.r = f.g = f.b = 0;
+  memset(f.fill, 0, sizeof(f.fill));
+  if(size != 3 && size != 4) return false;
+
+  uint8_t found = 0;
+  for(uint8_t i=0; i<size; i++) {
+    f.fill[i] = black[i];
+
+    if(probe[i] == 0x11 && probe2[i] == 0xEE && black[i] == 0) {
+      f.r = i;
+      found |= 1;
+    } else if(probe[i] == 0x22 && probe2[i] == 0xDD && black[i] == 0) {
+      f.g = i;
+      found |= 2;
+    } else if(probe[i] == 0x33 && probe2[i] == 0xCC && black[i] == 0) {
+      f.b = i;
+      found |= 4;
+    } else if(probe[i] != black[i] || probe2[i] != black[i]) {
+      return false;
+    }
+  }
+  if(found != 7) return false;
+
+#ifdef NEOGFX_SSSE3_CONVERT
+  for(uint8_t chunk=0; chunk<size; chunk++) {
+    for(uint8_t i=0; i<16; i++) {
+      uint8_t pixel = (chunk * 16 + i) / size;
+      uint8_t byte  = (chunk * 16 + i) % size;
+
+      f.shuffle[chunk][0][i] = byte == f.r ? pixel : 0x80;
+      f.shuffle[chunk][1][i] = byte == f.g ? pixel : 0x80;
+      f.shuffle[chunk][2][i] = byte == f.b ? pixel : 0x80;
+      f.fillChunk[chunk][i]  = black[byte];
+    }
+  }
+#endif
+
+  f.size = size;
+  return true;
+}
+
+// The channels of a pixel as they are on the wire, in the lower bytes of
+// a word. The fields of the format are passed in locals, as the stores of
+// the converted bytes could otherwise change them for the compiler.
+inline uint32_t neoGfxWirePixel(const uint8_t* red, const uint8_t* green, const uint8_t* blue, uint32_t fill, uint8_t shiftR, uint8_t shiftG, uint8_t shiftB, uint16_t color) {
+  return fill | ((uint32_t)red  [ color >> 11        ] << shiftR)
+              | ((uint32_t)green[(color >> 5) & 0x3F] << shiftG)
+              | ((uint32_t)blue [ color       & 0x1F] << shiftB);
+}
+
+#ifdef NEOGFX_SSSE3_CONVERT
+// Looks up 16 indices below 16 * n in n tables of 16 bytes. Adding 0x70
+// with saturation keeps the indices of the current table below 0x80 and
+// sets the top bit of all others, which makes pshufb return 0 for them.
+inline __m128i neoGfxLookup(const uint8_t* table, uint8_t n, __m128i index) {
+  const __m128i bias = _mm_set1_epi8(0x70);
+  const __m128i step = _mm_set1_epi8(16);
+  __m128i result = _mm_setzero_si128();
+
+  for(uint8_t i=0; i<n; i++) {
+    __m128i t = _mm_loadu_si128((const __m128i*)(table + i * 16));
+    result = _mm_or_si128(result, _mm_shuffle_epi8(t, _mm_adds_epu8(index, bias)));
+    index = _mm_sub_epi8(index, step);
+  }
+  return result;
+}
+#endif
+
+// Converts count 565 colors to the bytes of the feature at out. The
+// format has to be probed successfully.
+inline void neoGfxConvert565(const NeoGfxWireFormat& f, const uint16_t* in, uint8_t* out, uint16_t count) {
+  const uint8_t size = f.size;
+
+#if defined(NEOGFX_SSSE3_CONVERT)
+  const __m128i mask5 = _mm_set1_epi16(0x1F);
+  const __m128i mask6 = _mm_set1_epi16(0x3F);
+
+  for(; count >= 16; count -= 16, in += 16, out += 16 * size) {
+    __m128i lo = _mm_loadu_si128((const __m128i*) in);
+    __m128i hi = _mm_loadu_si128((const __m128i*)(in + 8));
+
+    __m128i r = _mm_packus_epi16(_mm_srli_epi16(lo, 11), _mm_srli_epi16(hi, 11));
+    __m128i g = _mm_packus_epi16(_mm_and_si128(_mm_srli_epi16(lo, 5), mask6), _mm_and_si128(_mm_srli_epi16(hi, 5), mask6));
+    __m128i b = _mm_packus_epi16(_mm_and_si128(lo, mask5), _mm_and_si128(hi, mask5));
+
+    r = neoGfxLookup(f.red,   2, r);
+    g = neoGfxLookup(f.green, 4, g);
+    b = neoGfxLookup(f.blue,  2, b);
+
+    for(uint8_t chunk=0; chunk<size; chunk++) {
+      __m128i bytes = _mm_loadu_si128((const __m128i*) f.fillChunk[chunk]);
+      bytes = _mm_or_si128(bytes, _mm_shuffle_epi8(r, _mm_loadu_si128((const __m128i*) f.shuffle[chunk][0])));
+      bytes = _mm_or_si128(bytes, _mm_shuffle_epi8(g, _mm_loadu_si128((const __m128i*) f.shuffle[chunk][1])));
+      bytes = _mm_or_si128(bytes, _mm_shuffle_epi8(b, _mm_loadu_si128((const __m128i*) f.shuffle[chunk][2])));
+      _mm_storeu_si128((__m128i*)(out + chunk * 16), bytes);
+    }
+  }
+#elif defined(NEOGFX_NEON_CONVERT)
+  const uint8x16x2_t redTable   = { { vld1q_u8(f.red),   vld1q_u8(f.red + 16) } };
+  const uint8x16x4_t greenTable = { { vld1q_u8(f.green), vld1q_u8(f.green + 16), vld1q_u8(f.green + 32), vld1q_u8(f.green + 48) } };
+  const uint8x16x2_t blueTable  = { { vld1q_u8(f.blue),  vld1q_u8(f.blue + 16) } };
+
+  for(; count >= 16; count -= 16, in += 16, out += 16 * size) {
+    uint16x8_t lo = vld1q_u16(in);
+    uint16x8_t hi = vld1q_u16(in + 8);
+
+    uint8x16_t r = vcombine_u8(vmovn_u16(vshrq_n_u16(lo, 11)), vmovn_u16(vshrq_n_u16(hi, 11)));
+    uint8x16_t g = vandq_u8(vcombine_u8(vshrn_n_u16(lo, 5), vshrn_n_u16(hi, 5)), vdupq_n_u8(0x3F));
+    uint8x16_t b = vandq_u8(vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)), vdupq_n_u8(0x1F));
+
+    r = vqtbl2q_u8(redTable,   r);
+    g = vqtbl4q_u8(greenTable, g);
+    b = vqtbl2q_u8(blueTable,  b);
+
+    if(size == 3) {
+      uint8x16x3_t pixels;
+      pixels.val[f.r] = r;
+      pixels.val[f.g] = g;
+      pixels.val[f.b] = b;
+      vst3q_u8(out, pixels);
+    } else {
+      uint8x16x4_t pixels;
+      for(uint8_t i=0; i<4; i++) {
+        pixels.val[i] = vdupq_n_u8(f.fill[i]);
+      }
+      pixels.val[f.r] = r;
+      pixels.val[f.g] = g;
+      pixels.val[f.b] = b;
+      vst4q_u8(out, pixels);
+    }
+  }
+#endif
+
+  const uint8_t* red   = f.red;
+  const uint8_t* green = f.green;
+  const uint8_t* blue  = f.blue;
+  const uint32_t fill  = f.fill[0] | (f.fill[1] << 8) | ((uint32_t)f.fill[2] << 16) | ((uint32_t)f.fill[3] << 24);
+  const uint8_t shiftR = f.r * 8, shiftG = f.g * 8, shiftB = f.b * 8;
+
+#ifdef NEOGFX_SWAR_CONVERT
+  // 4 pixels are 3 or 4 words, stored at once if out is aligned
+  if(((uintptr_t)out & 3) == 0) {
+    uint32_t* words = (uint32_t*) out;
+
+    for(; count >= 4; count -= 4, in += 4) {
+      uint32_t p0 = neoGfxWirePixel(red, green, blue, fill, shiftR, shiftG, shiftB, in[0]);
+      uint32_t p1 = neoGfxWirePixel(red, green, blue, fill, shiftR, shiftG, shiftB, in[1]);
+      uint32_t p2 = neoGfxWirePixel(red, green, blue, fill, shiftR, shiftG, shiftB, in[2]);
+      uint32_t p3 = neoGfxWirePixel(red, green, blue, fill, shiftR, shiftG, shiftB, in[3]);
+
+      if(size == 4) {
+        words[0] = p0;
+        words[1] = p1;
+        words[2] = p2;
+        words[3] = p3;
+        words += 4;
+      } else {
+        words[0] = p0 | (p1 << 24);
+        words[1] = (p1 >> 8) | (p2 << 16);
+        words[2] = (p2 >> 16) | (p3 << 8);
+        words += 3;
+      }
+    }
+    out = (uint8_t*) words;
+  }
+#endif
+
+  for(; count > 0; count--, in++) {
+    uint32_t pixel = neoGfxWirePixel(red, green, blue, fill, shiftR, shiftG, shiftB, *in);
+    for(uint8_t i=0; i<size; i++, pixel >>= 8) {
+      *out++ = pixel;
+    }
+  }
+}
+
+#endif // NEOGFX_NO_BULK_CONVERT
+
+#endif // _ADAFRUIT_NEOGFXCONVERT_H_
@@ -21,9 +21,15 @@
 
 #if ARDUINO >= 100
  #include <Arduino.h>
-#else
+#elif defined(ARDUINO)
  #include <WProgram.h>
  #include <pins_arduino.h>
+#else
+ // Outside of Arduino (e.g. a build on the host) the Adafruit_GFX.h and
+ // NeoPixelBus.h on the include path have to provide the Arduino types.
+ #include <stdint.h>
+ #include <stdlib.h>
+ #include <string.h>
 #endif
 #include <Adafruit_GFX.h>
 #include <NeoPixelBus.h>
@@ -40,37 +46,44 @@
  #endif
 #endif
 
-template<typename T_COLOR_FEATURE, typename T_METHOD>
+// T_LAYOUT selects how x/y is mapped to the pixels, see NeoGfx.
+// With the default NeoGfxRemapLayout the function passed to
+// setRemapFunction is used.
+// T_GAMMA selects the gamma tables, e.g. NeoGfxGamma<220> (see gamma.h).
+template<typename T_COLOR_FEATURE, typename T_METHOD, typename T_LAYOUT = NeoGfxRemapLayout, typename T_GAMMA = NeoGfxDefaultGamma>
 class NeoPixelBusGfx : public Adafruit_GFX, public NeoPixelBus<T_COLOR_FEATURE, T_METHOD> {
 
  public:
 
     // Constructor: number of LEDs, pin number
     // NOTE:  Pin Number maybe ignored due to hardware limitations of the method.
+    // A matrix too big for the bus or for NeoGfxDim gets no pixels (see
+    // NeoGfx::busPixels), check PixelCount() after constructing it.
     
     NeoPixelBusGfx(int w, int h, uint8_t pin) :
       Adafruit_GFX(w, h),
-      NeoPixelBus<T_COLOR_FEATURE, T_METHOD>(w * h, pin),
-      neoGfx(NeoGfx<T_COLOR_FEATURE, T_METHOD, NeoPixelBus<T_COLOR_FEATURE, T_METHOD>>(w, h, this))
+      NeoPixelBus<T_COLOR_FEATURE, T_METHOD>(NeoGfx<T_COLOR_FEATURE, T_METHOD, NeoPixelBus<T_COLOR_FEATURE, T_METHOD>, T_LAYOUT, T_GAMMA>::busPixels(w, h), pin),
+      neoGfx(w, h, this)
     {
     }
 
     NeoPixelBusGfx(int w, int h, uint8_t pinClock, uint8_t pinData) :
       Adafruit_GFX(w, h),
-      NeoPixelBus<T_COLOR_FEATURE, T_METHOD>(w * h, pinClock, pinData),
-      neoGfx(NeoGfx<T_COLOR_FEATURE, T_METHOD, NeoPixelBus<T_COLOR_FEATURE, T_METHOD>>(w, h, this))
+      NeoPixelBus<T_COLOR_FEATURE, T_METHOD>(NeoGfx<T_COLOR_FEATURE, T_METHOD, NeoPixelBus<T_COLOR_FEATURE, T_METHOD>, T_LAYOUT, T_GAMMA>::busPixels(w, h), pinClock, pinData),
+      neoGfx(w, h, this)
     {
     }
 
     NeoPixelBusGfx(int w, int h) :
       Adafruit_GFX(w, h),
-      NeoPixelBus<T_COLOR_FEATURE, T_METHOD>(w * h),
-      neoGfx(NeoGfx<T_COLOR_FEATURE, T_METHOD, NeoPixelBus<T_COLOR_FEATURE, T_METHOD>>(w, h, this))
+      NeoPixelBus<T_COLOR_FEATURE, T_METHOD>(NeoGfx<T_COLOR_FEATURE, T_METHOD, NeoPixelBus<T_COLOR_FEATURE, T_METHOD>, T_LAYOUT, T_GAMMA>::busPixels(w, h)),
+      neoGfx(w, h, this)
     {
     }
 
   protected:
-    NeoGfx<T_COLOR_FEATURE, T_METHOD, NeoPixelBus<T_COLOR_FEATURE, T_METHOD>> neoGfx;
+    NeoGfx<T_COLOR_FEATURE, T_METHOD, NeoPixelBus<T_COLOR_FEATURE, T_METHOD>, T_LAYOUT, T_GAMMA> neoGfx;
+
 
   public:
 
@@ -82,10 +95,216 @@ class NeoPixelBusGfx : public Adafruit_GFX, public NeoPixelBus<T_COLOR_FEATURE,
       neoGfx.fillScreen(color);
     }
 
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+      neoGfx.writeFastHLine(x, y, w, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+      neoGfx.writeFastVLine(x, y, h, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+      neoGfx.writeFastHLine(x, y, w, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+      neoGfx.writeFastVLine(x, y, h, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+      neoGfx.fillRect(x, y, w, h, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+      neoGfx.fillRect(x, y, w, h, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
     void clear() {
       neoGfx.fillScreen(0);
     }
 
+    // Moves the content by dx/dy pixels and fills the uncovered part with
+    // color, so e.g. a ticker only has to draw the new column.
+    void scroll(int16_t dx, int16_t dy, uint16_t color = 0) {
+      neoGfx.scroll(dx, dy, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    // Drawing with the colors of the feature (e.g. RgbColor or RgbwColor).
+    // The colors are used as they are, without gamma correction. With
+    // indexed colors these draw nothing, see enableIndexedColor().
+    using Adafruit_GFX::drawLine;
+    using Adafruit_GFX::drawRect;
+    using Adafruit_GFX::drawCircle;
+    using Adafruit_GFX::fillCircle;
+    using Adafruit_GFX::setTextColor;
+    using Adafruit_GFX::write;
+
+    void drawPixel(int16_t x, int16_t y, typename T_COLOR_FEATURE::ColorObject color) {
+      if(neoGfx.hasIndexedColor()) return;
+      neoGfx.drawPixel(x, y, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void fillScreen(typename T_COLOR_FEATURE::ColorObject color) {
+      if(neoGfx.hasIndexedColor()) return;
+      neoGfx.fillScreen(color);
+    }
+
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, typename T_COLOR_FEATURE::ColorObject color) {
+      if(neoGfx.hasIndexedColor()) return;
+      neoGfx.writeFastHLine(x, y, w, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, typename T_COLOR_FEATURE::ColorObject color) {
+      if(neoGfx.hasIndexedColor()) return;
+      neoGfx.writeFastVLine(x, y, h, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, typename T_COLOR_FEATURE::ColorObject color) {
+      if(neoGfx.hasIndexedColor()) return;
+      neoGfx.drawLine(x0, y0, x1, y1, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, typename T_COLOR_FEATURE::ColorObject color) {
+      if(neoGfx.hasIndexedColor()) return;
+      neoGfx.drawRect(x, y, w, h, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, typename T_COLOR_FEATURE::ColorObject color) {
+      if(neoGfx.hasIndexedColor()) return;
+      neoGfx.fillRect(x, y, w, h, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void drawCircle(int16_t x0, int16_t y0, int16_t r, typename T_COLOR_FEATURE::ColorObject color) {
+      if(neoGfx.hasIndexedColor()) return;
+      neoGfx.drawCircle(x0, y0, r, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void fillCircle(int16_t x0, int16_t y0, int16_t r, typename T_COLOR_FEATURE::ColorObject color) {
+      if(neoGfx.hasIndexedColor()) return;
+      neoGfx.fillCircle(x0, y0, r, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void scroll(int16_t dx, int16_t dy, typename T_COLOR_FEATURE::ColorObject color) {
+      if(neoGfx.hasIndexedColor()) return;
+      neoGfx.scroll(dx, dy, color, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    // transparent text
+    void setTextColor(typename T_COLOR_FEATURE::ColorObject color) {
+      if(neoGfx.hasIndexedColor()) return;
+      neoGfx.setNativeTextColor(color, color);
+      Adafruit_GFX::setTextColor(0xFFFF);
+    }
+
+    void setTextColor(typename T_COLOR_FEATURE::ColorObject color, typename T_COLOR_FEATURE::ColorObject bg) {
+      if(neoGfx.hasIndexedColor()) return;
+      neoGfx.setNativeTextColor(color, bg);
+      Adafruit_GFX::setTextColor(0xFFFF, 0);
+    }
+
+    void setTextColor(uint16_t c) {
+      neoGfx.clearNativeTextColor();
+      Adafruit_GFX::setTextColor(c);
+    }
+
+    void setTextColor(uint16_t c, uint16_t bg) {
+      neoGfx.clearNativeTextColor();
+      Adafruit_GFX::setTextColor(c, bg);
+    }
+
+    size_t write(uint8_t c) {
+      if(neoGfx.hasNativeTextColor()) {
+        return neoGfx.writeNativeText(this, c, cursor_x, cursor_y, gfxFont, textsize_x, textsize_y, wrap, _width, _height, rotation, WIDTH, HEIGHT);
+      }
+      return neoGfx.hasGlyphCache() ?
+        neoGfx.write(this, c, cursor_x, cursor_y, gfxFont, textsize_x, textsize_y, textcolor, textbgcolor, wrap, _width, _height, rotation, WIDTH, HEIGHT) :
+        Adafruit_GFX::write(c);
+    }
+
+    void cp437(bool x = true) {
+      Adafruit_GFX::cp437(x);
+      neoGfx.clearGlyphCache();
+    }
+
+    // Caches the rasterized characters, see NeoGfx.
+    bool enableGlyphCache(uint16_t bytes = NEOGFX_GLYPH_CACHE_SIZE) {
+      return neoGfx.enableGlyphCache(bytes);
+    }
+
+    void freeGlyphCache() {
+      neoGfx.freeGlyphCache();
+    }
+
+    void clearGlyphCache() {
+      neoGfx.clearGlyphCache();
+    }
+
+    // The bitmap overloads below replace the per pixel versions of
+    // Adafruit_GFX, the masked versions are still the ones of Adafruit_GFX.
+    using Adafruit_GFX::drawBitmap;
+    using Adafruit_GFX::drawGrayscaleBitmap;
+    using Adafruit_GFX::drawRGBBitmap;
+
+    void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color) {
+      neoGfx.drawBitmap(x, y, bitmap, true, w, h, color, NULL, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+      neoGfx.drawBitmap(x, y, bitmap, true, w, h, color, &bg, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h, uint16_t color) {
+      neoGfx.drawBitmap(x, y, bitmap, false, w, h, color, NULL, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+      neoGfx.drawBitmap(x, y, bitmap, false, w, h, color, &bg, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void drawGrayscaleBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h) {
+      neoGfx.drawGrayscaleBitmap(x, y, bitmap, true, w, h, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void drawGrayscaleBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h) {
+      neoGfx.drawGrayscaleBitmap(x, y, bitmap, false, w, h, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w, int16_t h) {
+      neoGfx.drawRGBBitmap(x, y, bitmap, true, w, h, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void drawRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) {
+      neoGfx.drawRGBBitmap(x, y, bitmap, false, w, h, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    // 24-bit bitmap with 3 bytes (r, g, b) per pixel, drawn without gamma correction.
+    void drawRGB24Bitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h) {
+      neoGfx.drawRGB24Bitmap(x, y, bitmap, true, w, h, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void drawRGB24Bitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h) {
+      neoGfx.drawRGB24Bitmap(x, y, bitmap, false, w, h, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    // Bitmap of NeoPixelBus colors (e.g. RgbColor or RgbwColor), drawn without any conversion.
+    void drawNativeBitmap(int16_t x, int16_t y, const typename T_COLOR_FEATURE::ColorObject bitmap[], int16_t w, int16_t h) {
+      neoGfx.drawNativeBitmap(x, y, bitmap, true, w, h, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    void drawNativeBitmap(int16_t x, int16_t y, typename T_COLOR_FEATURE::ColorObject *bitmap, int16_t w, int16_t h) {
+      neoGfx.drawNativeBitmap(x, y, bitmap, false, w, h, _width, _height, rotation, WIDTH, HEIGHT);
+    }
+
+    // Writes the pixels of a frame stream, see NeoGfx. Returns true at the
+    // end of a frame.
+    bool feedStream(const uint8_t* data, size_t length) {
+      return neoGfx.feedStream(data, length);
+    }
+
+    void resetStream() {
+      neoGfx.resetStream();
+    }
+
     /**
      * @deprecated Prefer usage of the NeoPixelBus colors directly (e.g. RgbColor(...) and RgbwColor(...))
      * as the usage of a white uint32_t is not supported. (e.g. 0xFF000000 results in 0x000000 but RgbwColor(0, 0, 0, 255) works)
@@ -102,16 +321,275 @@ class NeoPixelBusGfx : public Adafruit_GFX, public NeoPixelBus<T_COLOR_FEATURE,
       neoGfx.setPassThruColor();
     }
     
+    void setRemapFunction(NeoGfxIndex (*fn)(uint16_t, uint16_t)) {
+      neoGfx.setRemapFunction(fn);
+    }
+
+#ifdef NEOGFX_LARGE_MATRIX
     void setRemapFunction(uint16_t (*fn)(uint16_t, uint16_t)) {
       neoGfx.setRemapFunction(fn);
     }
+#endif
+
+    void setRemapTable_P(const NeoGfxIndex* table) {
+      neoGfx.setRemapTable_P(table);
+    }
+
+    bool enableRemapTable() {
+      return neoGfx.enableRemapTable();
+    }
+
+    void buildRemapTable() {
+      neoGfx.buildRemapTable();
+    }
+
+    void freeRemapTable() {
+      neoGfx.freeRemapTable();
+    }
+
+    bool enableColorTable() {
+      return neoGfx.enableColorTable();
+    }
+
+    void freeColorTable() {
+      neoGfx.freeColorTable();
+    }
+
+    // Draw into an off-screen buffer and show it with present(), see NeoGfx.
+    bool enableBackBuffer() {
+      return neoGfx.enableBackBuffer();
+    }
+
+    void freeBackBuffer() {
+      neoGfx.freeBackBuffer();
+    }
+
+    // Shows the back buffer if the bus is ready, returns false if it is busy.
+    bool present() {
+      return neoGfx.present();
+    }
+
+    // Sprites blended over the back buffer by present(), see NeoGfx.
+    int8_t addSprite(const typename T_COLOR_FEATURE::ColorObject* pixels, int16_t w, int16_t h, int16_t x = 0, int16_t y = 0, int8_t z = 0) {
+      return neoGfx.addSprite(pixels, w, h, x, y, z);
+    }
+
+    void removeSprite(int8_t id) {
+      neoGfx.removeSprite(id);
+    }
+
+    void moveSprite(int8_t id, int16_t x, int16_t y) {
+      neoGfx.moveSprite(id, x, y);
+    }
+
+    void setSpritePixels(int8_t id, const typename T_COLOR_FEATURE::ColorObject* pixels) {
+      neoGfx.setSpritePixels(id, pixels);
+    }
+
+    void setSpriteZ(int8_t id, int8_t z) {
+      neoGfx.setSpriteZ(id, z);
+    }
+
+    void setSpriteAlpha(int8_t id, uint8_t alpha) {
+      neoGfx.setSpriteAlpha(id, alpha);
+    }
+
+    void setSpriteColorKey(int8_t id, typename T_COLOR_FEATURE::ColorObject key) {
+      neoGfx.setSpriteColorKey(id, key);
+    }
+
+    void clearSpriteColorKey(int8_t id) {
+      neoGfx.clearSpriteColorKey(id);
+    }
+
+    void setSpriteVisible(int8_t id, bool visible) {
+      neoGfx.setSpriteVisible(id, visible);
+    }
+
+    // Gamma correction and brightness applied by present(), so changing the
+    // brightness doesn't need a redraw, see NeoGfx.
+    bool enableOutputTable(uint8_t brightness = 255) {
+      return neoGfx.enableOutputTable(brightness);
+    }
+
+    void freeOutputTable() {
+      neoGfx.freeOutputTable();
+    }
+
+    void setOutputBrightness(uint8_t brightness) {
+      neoGfx.setOutputBrightness(brightness);
+    }
+
+    uint8_t getOutputBrightness() const {
+      return neoGfx.getOutputBrightness();
+    }
+
+    // Keeps palette indices instead of colors, expanded on Show(). The
+    // colors passed to the drawing functions are then palette indices,
+    // see NeoGfx.
+    bool enableIndexedColor(uint8_t bits = 8) {
+      return neoGfx.enableIndexedColor(bits);
+    }
+
+    void freeIndexedColor() {
+      neoGfx.freeIndexedColor();
+    }
+
+    void setPaletteColor(uint8_t index, uint16_t color) {
+      neoGfx.setPaletteColor(index, color);
+    }
+
+    void setPaletteColor(uint8_t index, typename T_COLOR_FEATURE::ColorObject color) {
+      neoGfx.setPaletteColor(index, color);
+    }
+
+    typename T_COLOR_FEATURE::ColorObject getPaletteColor(uint8_t index) const {
+      return neoGfx.getPaletteColor(index);
+    }
+
+    void cyclePalette(uint8_t first, uint16_t count) {
+      neoGfx.cyclePalette(first, count);
+    }
+
+    // Estimated current of the frame, kept up to date while drawing, see
+    // NeoGfx.
+    void enablePowerEstimate(const NeoGfxPowerModel& model = NeoGfxPowerModel()) {
+      neoGfx.enablePowerEstimate(model);
+    }
+
+    void disablePowerEstimate() {
+      neoGfx.disablePowerEstimate();
+    }
+
+    // Has to be called after changing pixels directly with SetPixelColor.
+    void recountPower() {
+      neoGfx.recountPower();
+    }
+
+    uint32_t getPowerEstimate() {
+      return neoGfx.getPowerEstimate();
+    }
+
+    uint32_t getPowerDemand() {
+      return neoGfx.getPowerDemand();
+    }
+
+    // The sums of the bytes of all pixels, PixelSize entries.
+    void getPowerSums(uint32_t* sums) const {
+      neoGfx.getPowerSums(sums);
+    }
+
+    // Scales the brightness in present() to stay below milliamps (0: no
+    // limit), see NeoGfx.
+    bool setPowerLimit(uint32_t milliamps) {
+      return neoGfx.setPowerLimit(milliamps);
+    }
+
+    uint32_t getPowerLimit() const {
+      return neoGfx.getPowerLimit();
+    }
+
+    uint8_t getPowerLimitBrightness() const {
+      return neoGfx.getPowerLimitBrightness();
+    }
+
+    // Shows the frame, with a back buffer it is presented.
+    void Show(bool maintainBufferConsistency = true) {
+      neoGfx.showFrame(maintainBufferConsistency);
+    }
+
+    // Shows the frame only if a pixel changed since it was shown last
+    // (with a back buffer it is presented). Returns true if it was shown.
+    bool ShowIfDirty() {
+      return neoGfx.showIfDirty();
+    }
+
+    // Runs the render callback at the given frame rate, see NeoGfx.
+    void setFrameRate(uint16_t fps) {
+      neoGfx.setFrameRate(fps);
+    }
+
+    void setRenderCallback(void (*fn)(uint32_t deltaMicros)) {
+      neoGfx.setRenderCallback(fn);
+    }
+
+    // Has to be called from loop(), returns true if a frame was rendered.
+    bool update() {
+      return neoGfx.update();
+    }
+
+    const NeoGfxFrameStats& getFrameStats() const {
+      return neoGfx.getFrameStats();
+    }
+
+    void resetFrameStats() {
+      neoGfx.resetFrameStats();
+    }
+
+    // Calls fn once per band of rows, the bands in parallel on the cores,
+    // see NeoGfx. Show the frame afterwards as usual.
+    void renderBands(void (*fn)(Adafruit_GFX& gfx, int16_t y, int16_t h), uint8_t bands) {
+      neoGfx.renderBands(fn, bands, _height, rotation);
+    }
+
+    bool isDirty() const {
+      return neoGfx.isDirty();
+    }
+
+    // The area which changed since the frame was shown last.
+    // Returns false if nothing changed.
+    bool getDirtyRect(int16_t& x, int16_t& y, int16_t& w, int16_t& h) const {
+      return neoGfx.getDirtyRect(x, y, w, h);
+    }
+
+    void resetDirty() {
+      neoGfx.resetDirty();
+    }
+
+    // Has to be called after changing pixels directly with SetPixelColor.
+    void markDirty() {
+      neoGfx.markDirty();
+    }
+
+    void setRotation(uint8_t r) {
+      Adafruit_GFX::setRotation(r);
+      neoGfx.setRotation(rotation);
+    }
+
+#ifdef NEOGFX_STATS
+    // Profiling, see NeoGfxStats.
+    const NeoGfxStats& getStats() const {
+      return neoGfx.getStats();
+    }
+
+    void resetStats() {
+      neoGfx.resetStats();
+    }
+
+    void setFrameCallback(void (*fn)(const NeoGfxStats& stats)) {
+      neoGfx.setFrameCallback(fn);
+    }
+
+    void startWrite() override {
+      neoGfx.beginDraw();
+    }
+
+    void endWrite() override {
+      neoGfx.endDraw();
+    }
+#endif
 
     uint16_t Color(uint8_t r, uint8_t g, uint8_t b) {
       return neoGfx.Color(r, g, b);
     }
 
     static uint32_t expandColor(uint16_t color) {
-      return NeoGfx<T_COLOR_FEATURE, T_METHOD, NeoPixelBus<T_COLOR_FEATURE, T_METHOD>>::expandColor(color);
+      return NeoGfx<T_COLOR_FEATURE, T_METHOD, NeoPixelBus<T_COLOR_FEATURE, T_METHOD>, T_LAYOUT, T_GAMMA>::expandColor(color);
+    }
+
+    // Gamma adjusted full color, for the drawing with the colors of the feature
+    static typename T_COLOR_FEATURE::ColorObject correctGamma(const typename T_COLOR_FEATURE::ColorObject& color) {
+      return NeoGfx<T_COLOR_FEATURE, T_METHOD, NeoPixelBus<T_COLOR_FEATURE, T_METHOD>, T_LAYOUT, T_GAMMA>::correctGamma(color);
     }
 };
 
@@ -0,0 +1,403 @@
+/*--------------------------------------------------------------------
+  This file is based on the Adafruit NeoMatrix library.
+
+  NeoPixelBusGfx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation, either version 3 of
+  the License, or (at your option) any later version.
+
+  NeoPixelBusGfx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with NeoPixelBusGfx.  If not, see
+  <http://www.gnu.org/licenses/>.
+  --------------------------------------------------------------------*/
+
+#ifndef _ADAFRUIT_NEOPIXELMULTIBUSGFX_H_
+#define _ADAFRUIT_NEOPIXELMULTIBUSGFX_H_
+
+#if ARDUINO >= 100
+ #include <Arduino.h>
+#elif defined(ARDUINO)
+ #include <WProgram.h>
+ #include <pins_arduino.h>
+#else
+ // Outside of Arduino (e.g. a build on the host) the Adafruit_GFX.h and
+ // NeoPixelBus.h on the include path have to provide the Arduino types.
+ #include <stdint.h>
+ #include <stdlib.h>
+ #include <string.h>
+#endif
+#include <Adafruit_GFX.h>
+#include <NeoPixelBus.h>
+#include "NeoGfx.h"
+
+// One Adafruit_GFX surface driven by BUS_COUNT buses (e.g. several RMT or
+// I2S channels on an ESP32), so a big matrix can be refreshed in parallel.
+// The unrotated matrix is split into BUS_COUNT horizontal strips of
+// h / BUS_COUNT rows, strip i is on bus i. If h is not a multiple of
+// BUS_COUNT the last strip gets the rows left over. Each strip has its own
+// NeoGfx and is remapped (remap function or T_LAYOUT) in its own
+// coordinates, so all strips have to be wired the same way.
+template<typename T_COLOR_FEATURE, typename T_METHOD, uint8_t BUS_COUNT, typename T_LAYOUT = NeoGfxRemapLayout, typename T_GAMMA = NeoGfxDefaultGamma>
+class NeoPixelMultiBusGfx : public Adafruit_GFX {
+
+ public:
+
+    // Constructor: size of the whole matrix, one pin per bus
+    // NOTE:  Pin Number maybe ignored due to hardware limitations of the method.
+    // A strip too big for its bus or for NeoGfxDim gets no pixels (see
+    // NeoGfx::busPixels).
+
+    NeoPixelMultiBusGfx(int w, int h, const uint8_t pins[BUS_COUNT]) :
+      Adafruit_GFX(w, h),
+      stripHeight(h / BUS_COUNT)
+    {
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        buses[i] = new NeoPixelBus<T_COLOR_FEATURE, T_METHOD>(NeoGfx<T_COLOR_FEATURE, T_METHOD, NeoPixelBus<T_COLOR_FEATURE, T_METHOD>, T_LAYOUT, T_GAMMA>::busPixels(w, stripRows(i)), pins[i]);
+        strips[i] = new NeoGfx<T_COLOR_FEATURE, T_METHOD, NeoPixelBus<T_COLOR_FEATURE, T_METHOD>, T_LAYOUT, T_GAMMA>(w, stripRows(i), buses[i]);
+      }
+    }
+
+    NeoPixelMultiBusGfx(int w, int h) :
+      Adafruit_GFX(w, h),
+      stripHeight(h / BUS_COUNT)
+    {
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        buses[i] = new NeoPixelBus<T_COLOR_FEATURE, T_METHOD>(NeoGfx<T_COLOR_FEATURE, T_METHOD, NeoPixelBus<T_COLOR_FEATURE, T_METHOD>, T_LAYOUT, T_GAMMA>::busPixels(w, stripRows(i)));
+        strips[i] = new NeoGfx<T_COLOR_FEATURE, T_METHOD, NeoPixelBus<T_COLOR_FEATURE, T_METHOD>, T_LAYOUT, T_GAMMA>(w, stripRows(i), buses[i]);
+      }
+    }
+
+    ~NeoPixelMultiBusGfx() {
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        delete strips[i];
+        delete buses[i];
+      }
+    }
+
+    void Begin() {
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        buses[i]->Begin();
+      }
+    }
+
+    NeoPixelBus<T_COLOR_FEATURE, T_METHOD>& Bus(uint8_t index) {
+      return *buses[index];
+    }
+
+    uint8_t BusCount() const {
+      return BUS_COUNT;
+    }
+
+    // Returns true if all buses are ready for the next frame.
+    bool CanShow() const {
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        if(!buses[i]->CanShow()) return false;
+      }
+      return true;
+    }
+
+    // Waits until all buses are ready and then starts them one after the
+    // other. With asynchronous methods (RMT, I2S, DMA) Show only starts
+    // the transfer, so the buses send in parallel. Buses with a back buffer
+    // present it.
+    void Show(bool maintainBufferConsistency = true) {
+      while(!CanShow()) {
+        yield();
+      }
+      if(powerLimit) shareBudget();
+
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        strips[i]->showFrame(maintainBufferConsistency);
+      }
+    }
+
+    // Only the buses with changed pixels are shown (or presented).
+    // Returns true if any bus was shown.
+    bool ShowIfDirty() {
+      if(powerLimit) shareBudget();
+
+      bool shown = false;
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        shown |= strips[i]->showIfDirty();
+      }
+      return shown;
+    }
+
+    bool enableBackBuffer() {
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        if(!strips[i]->enableBackBuffer()) return false;
+      }
+      return true;
+    }
+
+    void freeBackBuffer() {
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        strips[i]->freeBackBuffer();
+      }
+    }
+
+    // Palette indices instead of colors on all buses, see NeoGfx. The
+    // palette colors are set on all of them.
+    bool enableIndexedColor(uint8_t bits = 8) {
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        if(!strips[i]->enableIndexedColor(bits)) return false;
+      }
+      return true;
+    }
+
+    void freeIndexedColor() {
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        strips[i]->freeIndexedColor();
+      }
+    }
+
+    void setPaletteColor(uint8_t index, uint16_t color) {
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        strips[i]->setPaletteColor(index, color);
+      }
+    }
+
+    void setPaletteColor(uint8_t index, typename T_COLOR_FEATURE::ColorObject color) {
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        strips[i]->setPaletteColor(index, color);
+      }
+    }
+
+    void cyclePalette(uint8_t first, uint16_t count) {
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        strips[i]->cyclePalette(first, count);
+      }
+    }
+
+    // Power estimate of all buses, see NeoGfx.
+    void enablePowerEstimate(const NeoGfxPowerModel& model = NeoGfxPowerModel()) {
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        strips[i]->enablePowerEstimate(model);
+      }
+    }
+
+    void disablePowerEstimate() {
+      powerLimit = 0;
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        strips[i]->disablePowerEstimate();
+      }
+    }
+
+    void recountPower() {
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        strips[i]->recountPower();
+      }
+    }
+
+    uint32_t getPowerEstimate() {
+      uint32_t current = 0;
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        current += strips[i]->getPowerEstimate();
+      }
+      return current;
+    }
+
+    uint32_t getPowerDemand() {
+      uint32_t current = 0;
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        current += strips[i]->getPowerDemand();
+      }
+      return current;
+    }
+
+    // One limit for all buses (e.g. on one power supply). Before presenting
+    // it is shared by the buses in proportion to their demand, so all of
+    // them are scaled alike.
+    bool setPowerLimit(uint32_t milliamps) {
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        if(!strips[i]->setPowerLimit(milliamps)) return false;
+      }
+      powerLimit = milliamps;
+      return true;
+    }
+
+    // Presents the changed back buffers at once. Returns false without
+    // waiting if a bus is still busy.
+    bool present() {
+      if(!CanShow()) return false;
+      if(powerLimit) shareBudget();
+
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        if(strips[i]->isDirty()) strips[i]->present();
+      }
+      return true;
+    }
+
+    bool isDirty() const {
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        if(strips[i]->isDirty()) return true;
+      }
+      return false;
+    }
+
+    // The remap function gets the coordinates within a strip
+    // (x < width, y < height / BUS_COUNT, plus the rows left over on the
+    // last strip).
+    void setRemapFunction(NeoGfxIndex (*fn)(uint16_t, uint16_t)) {
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        strips[i]->setRemapFunction(fn);
+      }
+    }
+
+#ifdef NEOGFX_LARGE_MATRIX
+    void setRemapFunction(uint16_t (*fn)(uint16_t, uint16_t)) {
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        strips[i]->setRemapFunction(fn);
+      }
+    }
+#endif
+
+    bool enableRemapTable() {
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        if(!strips[i]->enableRemapTable()) return false;
+      }
+      return true;
+    }
+
+    void freeRemapTable() {
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        strips[i]->freeRemapTable();
+      }
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) {
+      if((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return;
+
+      int16_t w = 1, h = 1;
+      rotateRect(x, y, w, h);
+      uint8_t strip = stripOf(y);
+      strips[strip]->drawPixel(x, y - strip * stripHeight, color, WIDTH, stripRows(strip), 0, WIDTH, stripRows(strip));
+    }
+
+    void fillScreen(uint16_t color) {
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        strips[i]->fillScreen(color);
+      }
+    }
+
+    void clear() {
+      fillScreen(0);
+    }
+
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+      fillRect(x, y, w, 1, color);
+    }
+
+    void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+      fillRect(x, y, 1, h, color);
+    }
+
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+      fillRect(x, y, w, 1, color);
+    }
+
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+      fillRect(x, y, 1, h, color);
+    }
+
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+      fillRect(x, y, w, h, color);
+    }
+
+    // The rect is clipped, rotated to the unrotated matrix and then split
+    // at the borders of the strips.
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+      if(w < 0) { x += w + 1; w = -w; }
+      if(h < 0) { y += h + 1; h = -h; }
+
+      if(x < 0) { w += x; x = 0; }
+      if(y < 0) { h += y; y = 0; }
+      if(x + w > _width)  w = _width  - x;
+      if(y + h > _height) h = _height - y;
+      if((w <= 0) || (h <= 0)) return;
+
+      rotateRect(x, y, w, h);
+
+      for(uint8_t strip = stripOf(y); strip < BUS_COUNT; strip++) {
+        int16_t top    = strip * stripHeight;
+        int16_t bottom = top + stripRows(strip);
+        if(top >= y + h) break;
+
+        int16_t y0 = y > top ? y : top;
+        int16_t y1 = y + h < bottom ? y + h : bottom;
+        strips[strip]->fillRect(x, y0 - top, w, y1 - y0, color, WIDTH, stripRows(strip), 0, WIDTH, stripRows(strip));
+      }
+    }
+
+    uint16_t Color(uint8_t r, uint8_t g, uint8_t b) {
+      return strips[0]->Color(r, g, b);
+    }
+
+    static uint32_t expandColor(uint16_t color) {
+      return NeoGfx<T_COLOR_FEATURE, T_METHOD, NeoPixelBus<T_COLOR_FEATURE, T_METHOD>, T_LAYOUT, T_GAMMA>::expandColor(color);
+    }
+
+  protected:
+    // The rows of strip i, the last one gets the rows left over.
+    int16_t stripRows(uint8_t i) const {
+      return i == BUS_COUNT - 1 ? HEIGHT - (BUS_COUNT - 1) * stripHeight : stripHeight;
+    }
+
+    // The strip of the unrotated row y.
+    uint8_t stripOf(int16_t y) const {
+      int16_t strip = stripHeight ? y / stripHeight : BUS_COUNT - 1;
+      return strip < BUS_COUNT ? strip : BUS_COUNT - 1;
+    }
+
+
+    // Rotates a clipped rect of the current rotation into the unrotated
+    // (raw) coordinates.
+    void rotateRect(int16_t& x, int16_t& y, int16_t& w, int16_t& h) {
+      int16_t t;
+      switch(rotation) {
+      case 1:
+        t = x;
+        x = WIDTH - y - h;
+        y = t;
+        t = w; w = h; h = t;
+        break;
+      case 2:
+        x = WIDTH  - x - w;
+        y = HEIGHT - y - h;
+        break;
+      case 3:
+        t = x;
+        x = y;
+        y = HEIGHT - t - w;
+        t = w; w = h; h = t;
+        break;
+      }
+    }
+
+    // Gives every bus its share of the power limit.
+    void shareBudget() {
+      uint32_t demand[BUS_COUNT];
+      uint32_t total = 0;
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        demand[i] = strips[i]->getPowerDemand();
+        total += demand[i];
+      }
+
+      for(uint8_t i=0; i<BUS_COUNT; i++) {
+        uint32_t share = total > powerLimit ? (uint64_t)powerLimit * demand[i] / total : powerLimit;
+        strips[i]->setPowerLimit(share ? share : 1);
+      }
+    }
+
+    const int16_t stripHeight;
+    uint32_t powerLimit = 0;
+    NeoPixelBus<T_COLOR_FEATURE, T_METHOD>* buses[BUS_COUNT];
+    NeoGfx<T_COLOR_FEATURE, T_METHOD, NeoPixelBus<T_COLOR_FEATURE, T_METHOD>, T_LAYOUT, T_GAMMA>* strips[BUS_COUNT];
+};
+
+#endif // _ADAFRUIT_NEOPIXELMULTIBUSGFX_H_
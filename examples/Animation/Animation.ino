@@ -0,0 +1,44 @@
+// NeoPixelBusGfx example playing a compressed animation on a 24 x 24 pixel matrix.
+// smileys.h was created from the bitmaps of the MatrixGFXDemo example with
+//   tools/neogfx_anim.py -W 24 -H 24 -d 1000 -n smileys heart24.h yellowsmiley24.h bluesmiley24.h smileytongue24.h
+// Only the first frame is stored completely, the others only contain the
+// pixels which change, and only those are drawn.
+
+#include <NeoPixelBusGfx.h>
+#include <NeoPixelBus.h>
+#include <NeoGfxAnimation.h>
+#include "smileys.h"
+
+// Pins are method specific. See https://github.com/Makuna/NeoPixelBus/wiki/NeoPixelBus-object-API
+#define DATA_PIN 2
+
+#define WIDTH 24
+#define HEIGHT 24
+
+// See NeoPixelBus documentation for choosing the correct Feature and Method
+// (https://github.com/Makuna/NeoPixelBus/wiki/NeoPixelBus-object)
+NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> matrix(WIDTH, HEIGHT, DATA_PIN);
+
+// See NeoPixelBus documentation for choosing the correct NeoTopology
+// (https://github.com/Makuna/NeoPixelBus/wiki/Matrix-Panels-Support)
+NeoTopology<ColumnMajorAlternating180Layout> topo(WIDTH, HEIGHT);
+
+uint16_t remap(uint16_t x, uint16_t y) {
+  return topo.Map(x, y);
+}
+
+// To play a file instead: NeoGfxAnimation<NeoGfxFileReader<File> > animation(file);
+NeoGfxAnimation<NeoGfxProgmemReader> animation(smileys);
+
+void setup() {
+  matrix.Begin();
+  matrix.setRemapFunction(&remap);
+
+  animation.begin();
+}
+
+void loop() {
+  uint16_t duration = animation.drawFrame(matrix, 0, 0);
+  matrix.ShowIfDirty();
+  delay(duration);
+}
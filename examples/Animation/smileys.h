@@ -0,0 +1,232 @@
+// Generated by tools/neogfx_anim.py from heart24.h yellowsmiley24.h bluesmiley24.h smileytongue24.h
+// 4 frames of 24x24 pixels, 3622 bytes
+
+const uint8_t smileys[] PROGMEM = {
+  0x4E, 0x41, 0x01, 0x18, 0x00, 0x18, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0xE8, 0x03, 0xEA, 0x02,
+  0x73, 0x00, 0x00, 0x84, 0x00, 0x98, 0x00, 0x98, 0x20, 0xA0, 0x20, 0xA0, 0x00, 0xA0, 0x45, 0x00,
+  0x00, 0x42, 0x00, 0x98, 0x81, 0x20, 0x98, 0x00, 0x98, 0x45, 0x00, 0x00, 0x88, 0x00, 0x98, 0x20,
+  0xA0, 0x02, 0xB1, 0x45, 0xC2, 0x05, 0xC2, 0x02, 0xB9, 0x81, 0xB0, 0x20, 0x90, 0x00, 0x20, 0x42,
+  0x00, 0x00, 0x87, 0x00, 0x98, 0xA1, 0xA8, 0xC4, 0xB9, 0xC4, 0xC1, 0xE2, 0xB8, 0x81, 0xB0, 0x20,
+  0xA0, 0x00, 0x58, 0x43, 0x00, 0x00, 0xFA, 0x20, 0xA0, 0xC4, 0xB9, 0xEF, 0xEC, 0xF4, 0xF5, 0xEF,
+  0xEC, 0x08, 0xDB, 0x43, 0xC9, 0xC2, 0xB8, 0x20, 0x98, 0x00, 0x40, 0x00, 0x00, 0x00, 0xA0, 0x25,
+  0xBA, 0xAE, 0xE4, 0xB2, 0xED, 0x0F, 0xED, 0x28, 0xDB, 0x23, 0xC9, 0xA1, 0xB8, 0x20, 0x98, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xE2, 0xB0, 0xAE, 0xE4, 0x76, 0xF6, 0x51, 0xED, 0x4C,
+  0xE4, 0x48, 0xDB, 0xC4, 0xD1, 0x63, 0xD1, 0x22, 0xB9, 0x20, 0x90, 0x23, 0x89, 0x2C, 0xD4, 0xF4,
+  0xF5, 0x76, 0xF6, 0x91, 0xED, 0x8D, 0xE4, 0x69, 0xDB, 0x83, 0xD1, 0xC2, 0xC8, 0x81, 0xB8, 0x20,
+  0x88, 0x00, 0x00, 0x00, 0x98, 0x20, 0xA0, 0x86, 0xD2, 0x71, 0xED, 0xEF, 0xEC, 0x28, 0xDB, 0xE4,
+  0xD1, 0xA4, 0xD1, 0x63, 0xD1, 0xE4, 0xD1, 0xC7, 0xD2, 0x28, 0xC3, 0xAE, 0xD4, 0x55, 0xF6, 0xD3,
+  0xED, 0xCE, 0xEC, 0x49, 0xDB, 0x45, 0xD2, 0xA4, 0xD1, 0x02, 0xC9, 0x22, 0xC9, 0x22, 0xC9, 0x81,
+  0xA8, 0x00, 0x70, 0x00, 0x98, 0x81, 0xA8, 0x28, 0xDB, 0xCE, 0xEC, 0x89, 0xDB, 0x83, 0xD1, 0xE2,
+  0xD0, 0xE2, 0xD0, 0x22, 0xD1, 0x05, 0xD2, 0x28, 0xDB, 0x0B, 0xE4, 0xCE, 0xEC, 0xAE, 0xEC, 0x0B,
+  0xE4, 0xE7, 0xDA, 0xA3, 0xD1, 0x02, 0xD1, 0xE2, 0xD0, 0x22, 0xD1, 0xC4, 0xD1, 0xC4, 0xD1, 0xC2,
+  0xB0, 0x40, 0x88, 0x20, 0xA0, 0xE2, 0xB0, 0xE7, 0xDA, 0x0B, 0xE4, 0xC7, 0xDA, 0x43, 0xD1, 0x22,
+  0xD1, 0x22, 0xD1, 0x23, 0xD1, 0xA4, 0xD1, 0x46, 0xDA, 0xE7, 0xDA, 0x48, 0xDB, 0x08, 0xDB, 0x66,
+  0xDA, 0xC4, 0xD1, 0x43, 0xD1, 0x22, 0xD1, 0x02, 0xD1, 0x63, 0xD1, 0x05, 0xD2, 0x46, 0xDA, 0x22,
+  0xB9, 0x60, 0x88, 0x20, 0x98, 0x22, 0xB1, 0x66, 0xDA, 0x28, 0xDB, 0x66, 0xDA, 0x43, 0x63, 0xD1,
+  0x85, 0x83, 0xD1, 0xA4, 0xD1, 0xC4, 0xD9, 0xE4, 0xD9, 0xC4, 0xD9, 0xA3, 0xD1, 0x42, 0x63, 0xD1,
+  0x8A, 0x43, 0xD1, 0xA3, 0xD1, 0x86, 0xDA, 0xC7, 0xDA, 0x63, 0xC1, 0x61, 0x90, 0x00, 0x70, 0xE2,
+  0xA8, 0x25, 0xDA, 0x45, 0xDA, 0xE4, 0xD9, 0x4D, 0x83, 0xD9, 0x88, 0x25, 0xDA, 0x08, 0xE3, 0xE7,
+  0xE2, 0x63, 0xB9, 0x81, 0x90, 0x00, 0x70, 0x81, 0x98, 0xE4, 0xD9, 0x05, 0xE2, 0x4D, 0xC4, 0xD9,
+  0x8D, 0x25, 0xE2, 0x08, 0xE3, 0x89, 0xEB, 0xA7, 0xE2, 0x02, 0xA9, 0xC2, 0x90, 0x00, 0x00, 0x40,
+  0x88, 0x43, 0xB9, 0x05, 0xE2, 0x45, 0xE2, 0x45, 0xE2, 0x25, 0xE2, 0x04, 0xE2, 0x47, 0xE4, 0xE1,
+  0x90, 0x05, 0xE2, 0x86, 0xE2, 0x28, 0xEB, 0xCA, 0xEB, 0x69, 0xEB, 0xA4, 0xC1, 0x02, 0xA1, 0x22,
+  0x99, 0x00, 0x00, 0x00, 0x00, 0xE2, 0xA0, 0x83, 0xC1, 0x86, 0xEA, 0xA7, 0xEA, 0xA6, 0xEA, 0x66,
+  0xEA, 0x45, 0xEA, 0x45, 0x25, 0xEA, 0xA0, 0x86, 0xEA, 0x08, 0xEB, 0x89, 0xEB, 0xEB, 0xEB, 0x69,
+  0xEB, 0xE4, 0xC9, 0x63, 0xA9, 0xE4, 0xA1, 0x22, 0x99, 0x00, 0x00, 0x00, 0x00, 0x22, 0x99, 0x42,
+  0xA1, 0x63, 0xB9, 0x86, 0xE2, 0x08, 0xF3, 0xE7, 0xEA, 0xA7, 0xEA, 0x86, 0xEA, 0x66, 0xEA, 0x46,
+  0xEA, 0x46, 0xEA, 0x66, 0xEA, 0xC7, 0xEA, 0x49, 0xEB, 0xCA, 0xF3, 0xEB, 0xF3, 0x28, 0xE3, 0xA4,
+  0xB9, 0xC4, 0xA9, 0x65, 0xAA, 0xC4, 0xA1, 0xA1, 0x88, 0x42, 0x00, 0x00, 0x93, 0xA3, 0xA1, 0xC4,
+  0xA1, 0x63, 0xB1, 0x25, 0xD2, 0x08, 0xEB, 0x08, 0xF3, 0xC7, 0xF2, 0xA7, 0xF2, 0xA6, 0xF2, 0xC7,
+  0xF2, 0x28, 0xF3, 0xAA, 0xF3, 0x0B, 0xF4, 0xCA, 0xF3, 0x86, 0xD2, 0xA3, 0xB1, 0x86, 0xB2, 0xC6,
+  0xB2, 0x24, 0xAA, 0x22, 0x99, 0x44, 0x00, 0x00, 0x91, 0xA3, 0xA1, 0x65, 0xAA, 0xC4, 0xA9, 0xA4,
+  0xB9, 0xC7, 0xE2, 0x28, 0xF3, 0x08, 0xF3, 0x08, 0xF3, 0x49, 0xF3, 0xCA, 0xF3, 0x2C, 0xFC, 0x89,
+  0xEB, 0xE4, 0xC1, 0x25, 0xB2, 0x28, 0xBB, 0xC6, 0xB2, 0x24, 0xAA, 0x22, 0x99, 0x46, 0x00, 0x00,
+  0x8F, 0x22, 0x99, 0x45, 0xAA, 0x45, 0xAA, 0x83, 0xB1, 0x86, 0xDA, 0x48, 0xFB, 0x89, 0xFB, 0xEB,
+  0xFB, 0x2C, 0xFC, 0x48, 0xE3, 0xC4, 0xB1, 0xC7, 0xBA, 0x28, 0xBB, 0x86, 0xB2, 0xC4, 0xA1, 0xA1,
+  0x90, 0x48, 0x00, 0x00, 0x8C, 0x81, 0x88, 0xC4, 0xA1, 0x65, 0xAA, 0x83, 0xA9, 0x66, 0xDA, 0x69,
+  0xFB, 0xCA, 0xFB, 0x28, 0xE3, 0xA4, 0xB1, 0x08, 0xBB, 0xE7, 0xB2, 0x45, 0xAA, 0x42, 0x99, 0x4C,
+  0x00, 0x00, 0x89, 0x22, 0x91, 0x25, 0xAA, 0x83, 0xA9, 0xC7, 0xE2, 0x28, 0xEB, 0xC4, 0xB1, 0x07,
+  0xBB, 0xC6, 0xB2, 0xE4, 0xA9, 0xC1, 0x88, 0x4F, 0x00, 0x00, 0x85, 0x04, 0xAA, 0xA4, 0xA9, 0xE4,
+  0xB1, 0xE7, 0xBA, 0xC6, 0xB2, 0xE4, 0xA1, 0x52, 0x00, 0x00, 0x83, 0xC4, 0xA1, 0x24, 0xAA, 0xE7,
+  0xB2, 0x04, 0xA2, 0x53, 0x00, 0x00, 0x83, 0x02, 0x91, 0xE4, 0xA1, 0xC3, 0xA1, 0xA1, 0x80, 0x54,
+  0x00, 0x00, 0x81, 0x40, 0x80, 0x20, 0x78, 0x49, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x73, 0x04, 0x82,
+  0x01, 0x08, 0x00, 0x08, 0x00, 0x08, 0x01, 0x8D, 0x40, 0x00, 0x80, 0x18, 0x22, 0x61, 0xA1, 0x82,
+  0xC4, 0xA3, 0x65, 0xBC, 0xA5, 0xC4, 0xA6, 0xCC, 0x45, 0xBC, 0x83, 0xA3, 0x80, 0x82, 0x01, 0x51,
+  0x40, 0x10, 0x60, 0x00, 0x00, 0x81, 0x01, 0x08, 0x00, 0x08, 0x02, 0x96, 0x40, 0x00, 0x20, 0x00,
+  0x01, 0x00, 0x40, 0x18, 0xE0, 0x61, 0xC2, 0xAB, 0xCA, 0xD5, 0x11, 0xF7, 0xB4, 0xFF, 0xF8, 0xFF,
+  0xF9, 0xFF, 0xF9, 0xFF, 0xF8, 0xFF, 0x74, 0xFF, 0xF1, 0xF6, 0x68, 0xCD, 0x82, 0xA3, 0x60, 0x51,
+  0x81, 0x18, 0x01, 0x00, 0x20, 0x00, 0x40, 0x00, 0x01, 0x00, 0x00, 0x93, 0x20, 0x00, 0x20, 0x00,
+  0x80, 0x28, 0xA2, 0x8A, 0x27, 0xD5, 0x51, 0xFF, 0xB7, 0xFF, 0xD7, 0xFF, 0xB5, 0xFF, 0xB5, 0xFF,
+  0x93, 0xFF, 0x73, 0xFF, 0x74, 0xFF, 0x95, 0xFF, 0x96, 0xFF, 0x57, 0xFF, 0xD0, 0xFE, 0x86, 0xCC,
+  0xA1, 0x7A, 0xA0, 0x18, 0x00, 0x98, 0x20, 0x00, 0x20, 0x00, 0x00, 0x08, 0x03, 0x08, 0xC0, 0x28,
+  0x40, 0x93, 0x49, 0xE5, 0x56, 0xFF, 0xF7, 0xFF, 0x92, 0xFF, 0x92, 0xFF, 0x71, 0xFF, 0x50, 0xFF,
+  0x70, 0xFF, 0x70, 0xFF, 0x30, 0xFF, 0x51, 0xFF, 0x31, 0xFF, 0x53, 0xFF, 0x97, 0xFF, 0x15, 0xFF,
+  0xC6, 0xD4, 0xE0, 0x82, 0x61, 0x28, 0x02, 0x08, 0x00, 0xBD, 0x21, 0x00, 0x60, 0x20, 0x80, 0x82,
+  0x69, 0xDD, 0x75, 0xFF, 0x52, 0xFF, 0x8F, 0xFF, 0x70, 0xFF, 0x50, 0xFF, 0x50, 0xFF, 0x91, 0xFF,
+  0x50, 0xF7, 0x90, 0xFF, 0x70, 0xFF, 0x10, 0xFF, 0xF0, 0xFE, 0xCE, 0xFE, 0x30, 0xFF, 0x12, 0xF7,
+  0xD3, 0xFE, 0xC7, 0xD4, 0xA0, 0x7A, 0x60, 0x18, 0x02, 0x08, 0x20, 0x00, 0xE0, 0x61, 0x65, 0xC4,
+  0x10, 0xFF, 0xB1, 0xFF, 0x4F, 0xFF, 0x0F, 0xFF, 0x51, 0xFF, 0x4E, 0xFF, 0x30, 0xFF, 0x11, 0xFF,
+  0xCD, 0xE5, 0x6F, 0xF6, 0x30, 0xFF, 0xEF, 0xFE, 0x0F, 0xFF, 0xD0, 0xFE, 0xAF, 0xFE, 0xED, 0xFE,
+  0xF0, 0xFE, 0x70, 0xFE, 0xE3, 0xB3, 0x00, 0x5A, 0x20, 0x08, 0x81, 0x30, 0x81, 0xA3, 0x6C, 0xFE,
+  0x13, 0xFF, 0x10, 0xFF, 0xEE, 0xFE, 0x2F, 0xFF, 0x4E, 0xFF, 0x2E, 0xFF, 0x0F, 0xFF, 0x0D, 0xDE,
+  0xC9, 0xBC, 0x2D, 0xE6, 0xEF, 0xFE, 0x42, 0xEE, 0xFE, 0xFF, 0xAF, 0xF6, 0x6C, 0xFE, 0x6E, 0xFE,
+  0x94, 0xFE, 0xAB, 0xED, 0x40, 0x9B, 0x60, 0x20, 0x20, 0x72, 0xA6, 0xBC, 0xCD, 0xFE, 0xEF, 0xFE,
+  0xCD, 0xFE, 0x2E, 0xFF, 0xEE, 0xFE, 0xEE, 0xFE, 0xED, 0xFE, 0xAE, 0xFE, 0xA8, 0xC4, 0x88, 0xBC,
+  0xAF, 0xFE, 0xCE, 0xFE, 0xCE, 0xFE, 0x8D, 0xFE, 0x6D, 0xFE, 0x6E, 0xFE, 0x8E, 0xFE, 0x6C, 0xFE,
+  0x2D, 0xFE, 0x8E, 0xFE, 0x44, 0xAC, 0xA1, 0x71, 0x01, 0x8B, 0x49, 0xED, 0x8C, 0xFE, 0xEC, 0xFE,
+  0xCD, 0xFE, 0xAD, 0xFE, 0xCD, 0xFE, 0xCD, 0xFE, 0xED, 0xFE, 0x0C, 0xEE, 0xE6, 0xB3, 0x6A, 0xDD,
+  0x8B, 0xFE, 0x8B, 0xFE, 0xAC, 0xFE, 0x4C, 0xFE, 0xEA, 0xCC, 0xAB, 0xED, 0x6B, 0xFE, 0x2B, 0xFE,
+  0x0D, 0xFE, 0x0D, 0xFE, 0xA7, 0xD4, 0xE0, 0x8A, 0x41, 0x93, 0xAA, 0xF5, 0xAD, 0xFE, 0x8B, 0xFE,
+  0x8B, 0xFE, 0x6B, 0xFE, 0x4A, 0xFE, 0x68, 0xFE, 0x47, 0xFE, 0xC2, 0xCC, 0xA0, 0xB3, 0xE7, 0xFD,
+  0xE5, 0xFD, 0x05, 0xFE, 0xE6, 0xF5, 0x84, 0xCC, 0x63, 0xA3, 0x89, 0xED, 0x09, 0xFE, 0x0A, 0xFE,
+  0xEB, 0xFD, 0xCB, 0xFD, 0x49, 0xE5, 0x20, 0x93, 0xA1, 0x9B, 0xA9, 0xFD, 0x4B, 0xFE, 0x4A, 0xFE,
+  0x48, 0xFE, 0xA7, 0xF5, 0x82, 0xD4, 0x24, 0xFE, 0xE5, 0xFD, 0xE5, 0xFD, 0xE4, 0xFD, 0xE5, 0xFD,
+  0xC4, 0xFD, 0xE4, 0xFD, 0x85, 0xF5, 0xC0, 0xA2, 0x20, 0xAB, 0x67, 0xFD, 0x86, 0xFD, 0xA7, 0xFD,
+  0xC9, 0xFD, 0xA9, 0xFD, 0x89, 0xED, 0x40, 0x93, 0x60, 0x93, 0xC8, 0xFD, 0x0A, 0xFE, 0xE8, 0xFD,
+  0xE5, 0xFD, 0xC7, 0xFD, 0x80, 0xBB, 0xE4, 0xFD, 0xC6, 0xFD, 0xE6, 0xFD, 0x84, 0xFD, 0xC5, 0xFD,
+  0xE6, 0xFD, 0xA5, 0xFD, 0x63, 0xD4, 0xE1, 0xA2, 0x42, 0xD4, 0x45, 0xFD, 0x44, 0xFD, 0x45, 0xFD,
+  0x46, 0xFD, 0x67, 0xFD, 0x27, 0xED, 0x40, 0x9B, 0x61, 0x9B, 0xFF, 0x67, 0xFD, 0xA7, 0xFD, 0xA5,
+  0xFD, 0xA3, 0xFD, 0xE7, 0xFD, 0x02, 0xCC, 0x84, 0xF5, 0xC5, 0xFD, 0xA6, 0xFD, 0xA5, 0xFD, 0xA4,
+  0xFD, 0xA4, 0xFD, 0x85, 0xFD, 0xC4, 0xE4, 0xC0, 0xC3, 0x45, 0xFD, 0x23, 0xFD, 0x23, 0xFD, 0x24,
+  0xFD, 0xC4, 0xFC, 0x05, 0xFD, 0xC5, 0xEC, 0x61, 0xA3, 0x62, 0x9B, 0xC4, 0xEC, 0x44, 0xFD, 0x84,
+  0xFD, 0x83, 0xFD, 0x64, 0xF5, 0xC5, 0xE4, 0x42, 0xCC, 0x63, 0xFD, 0x64, 0xFD, 0x85, 0xFD, 0x63,
+  0xFD, 0x84, 0xFD, 0x24, 0xFD, 0x65, 0xFD, 0x43, 0xFD, 0x44, 0xFD, 0x23, 0xFD, 0x03, 0xFD, 0x04,
+  0xFD, 0xA3, 0xFC, 0xA3, 0xFC, 0x84, 0xE4, 0x21, 0x9B, 0x41, 0x93, 0x63, 0xE4, 0x64, 0xFD, 0x44,
+  0xFD, 0x44, 0xFD, 0x64, 0xFD, 0x66, 0xFD, 0xE2, 0xCB, 0xE4, 0xEC, 0x86, 0xFD, 0x24, 0xFD, 0x44,
+  0xFD, 0x23, 0xFD, 0x45, 0xFD, 0x04, 0xFD, 0x24, 0xFD, 0x04, 0xFD, 0xE3, 0xFC, 0xC3, 0xFC, 0xC4,
+  0xFC, 0xA3, 0xFC, 0x82, 0xFC, 0x23, 0xD4, 0xE0, 0x8A, 0x40, 0x8B, 0xC0, 0xCB, 0x02, 0xF5, 0x04,
+  0xFD, 0x25, 0xFD, 0x43, 0xFD, 0x44, 0xFD, 0x06, 0xF5, 0x80, 0xBB, 0x82, 0xDC, 0x23, 0xF5, 0x44,
+  0xFD, 0x25, 0xFD, 0x04, 0xFD, 0x04, 0xFD, 0xE4, 0xFC, 0x83, 0xF4, 0xA3, 0xFC, 0xA4, 0xFC, 0x83,
+  0xFC, 0x82, 0xFC, 0x62, 0xF4, 0xA1, 0xBB, 0x00, 0x8B, 0xE0, 0x72, 0x41, 0xB3, 0xA3, 0xEC, 0xE3,
+  0xFC, 0xC4, 0xFC, 0x03, 0xFD, 0x04, 0xFD, 0x44, 0xFD, 0x27, 0xF5, 0x64, 0xDC, 0x02, 0xCC, 0x22,
+  0xCC, 0x22, 0xCC, 0x02, 0xD4, 0x22, 0xD4, 0x23, 0xDC, 0x02, 0xD4, 0x42, 0xEC, 0x42, 0xFC, 0x64,
+  0xFC, 0x82, 0xEC, 0x42, 0xDC, 0x22, 0xA3, 0xC0, 0x7A, 0xA1, 0x61, 0x20, 0x83, 0x02, 0xD4, 0x82,
+  0xFC, 0x05, 0xFD, 0xE4, 0xFC, 0xE1, 0xFC, 0xE3, 0xFC, 0x05, 0xFD, 0x9A, 0xE5, 0xFC, 0xE6, 0xF4,
+  0xE7, 0xFC, 0xC6, 0xFC, 0xC5, 0xFC, 0xA4, 0xF4, 0x83, 0xF4, 0x83, 0xFC, 0x83, 0xFC, 0xA4, 0xFC,
+  0x42, 0xF4, 0x23, 0xFC, 0xE2, 0xD3, 0x00, 0x83, 0x00, 0x49, 0x40, 0x18, 0xE2, 0x82, 0x20, 0x9B,
+  0x03, 0xDC, 0x82, 0xFC, 0xC3, 0xF4, 0xA3, 0xFC, 0x83, 0xFC, 0xA2, 0xFC, 0xA3, 0xFC, 0xC3, 0xFC,
+  0xA2, 0xFC, 0x42, 0x82, 0xFC, 0xA0, 0x62, 0xFC, 0x43, 0xFC, 0x63, 0xFC, 0x42, 0xEC, 0x42, 0xFC,
+  0xC1, 0xD3, 0x20, 0x8B, 0xA2, 0x7A, 0x40, 0x18, 0x20, 0x00, 0x80, 0x49, 0x20, 0x93, 0x61, 0xA3,
+  0x23, 0xDC, 0xA2, 0xFC, 0xA4, 0xFC, 0x85, 0xFC, 0x84, 0xFC, 0x83, 0xFC, 0x83, 0xFC, 0x82, 0xFC,
+  0x62, 0xFC, 0x63, 0xFC, 0x63, 0xFC, 0x44, 0xFC, 0x24, 0xFC, 0x62, 0xFC, 0x21, 0xFC, 0xC3, 0xDB,
+  0x60, 0x9B, 0x00, 0x83, 0x81, 0x41, 0x00, 0x08, 0x00, 0x95, 0x41, 0x10, 0x61, 0x6A, 0x00, 0x8B,
+  0x60, 0xA3, 0xE3, 0xD3, 0x63, 0xF4, 0x82, 0xF4, 0x82, 0xFC, 0x62, 0xFC, 0x43, 0xFC, 0x43, 0xFC,
+  0x23, 0xFC, 0x43, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x82, 0xFC, 0x03, 0xEC, 0x81, 0xCB, 0x80, 0xA3,
+  0x40, 0x93, 0x00, 0x6A, 0x20, 0x00, 0x02, 0x93, 0x00, 0x08, 0x62, 0x6A, 0x00, 0x8B, 0x41, 0x9B,
+  0x81, 0xBB, 0x41, 0xDC, 0x62, 0xEC, 0xA3, 0xFC, 0xC3, 0xFC, 0x82, 0xFC, 0x62, 0xFC, 0x83, 0xFC,
+  0x83, 0xFC, 0x62, 0xEC, 0x00, 0xD4, 0x81, 0xC3, 0x41, 0x93, 0x00, 0x8B, 0x01, 0x62, 0x21, 0x08,
+  0x00, 0x98, 0x20, 0x00, 0x01, 0x00, 0x20, 0x00, 0x01, 0x00, 0x21, 0x08, 0xC0, 0x59, 0x01, 0x8B,
+  0x40, 0x8B, 0x00, 0xAB, 0x41, 0xB3, 0xA2, 0xBB, 0xE2, 0xCB, 0x01, 0xCC, 0xE1, 0xCB, 0xC1, 0xCB,
+  0xA2, 0xBB, 0x41, 0xB3, 0x21, 0xA3, 0x40, 0x8B, 0xE1, 0x82, 0x80, 0x51, 0x40, 0x08, 0x01, 0x00,
+  0x20, 0x00, 0x01, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x90, 0x20, 0x00, 0x00, 0x08, 0x80, 0x30,
+  0x01, 0x72, 0x40, 0x83, 0x40, 0x8B, 0x20, 0x8B, 0x20, 0x93, 0x40, 0x9B, 0x40, 0x9B, 0x40, 0x93,
+  0x40, 0x8B, 0x20, 0x8B, 0x00, 0x83, 0x22, 0x6A, 0x80, 0x28, 0x20, 0x00, 0x00, 0x81, 0x00, 0x08,
+  0x01, 0x00, 0x00, 0xE8, 0x03, 0x74, 0x04, 0x94, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x02, 0x08,
+  0x02, 0x08, 0x01, 0x00, 0x41, 0x00, 0x20, 0x00, 0x02, 0x00, 0x02, 0x10, 0x01, 0x08, 0x20, 0x00,
+  0x00, 0x08, 0x00, 0x00, 0x40, 0x00, 0x60, 0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x08, 0x01, 0x95, 0x00, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+  0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x20, 0x00, 0x00, 0x00, 0x41, 0x00,
+  0x42, 0x01, 0x00, 0x00, 0x8F, 0x00, 0x08, 0x21, 0x10, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x01, 0x00, 0x43, 0x00, 0x02, 0x00, 0x22, 0x00, 0x21,
+  0x00, 0x00, 0x10, 0x01, 0x08, 0x42, 0x00, 0x00, 0x9A, 0x21, 0x00, 0x61, 0x00, 0x00, 0x00, 0x41,
+  0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x81,
+  0x18, 0xE2, 0x18, 0x89, 0x01, 0xF7, 0x23, 0xD8, 0x1B, 0xF8, 0x03, 0xD7, 0x33, 0xE9, 0x00, 0x44,
+  0x00, 0x01, 0x00, 0x20, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x9A, 0x01, 0x08, 0x40, 0x00, 0x20, 0x00, 0x00, 0x00, 0x21, 0x00, 0x01, 0x00, 0x00, 0x00, 0xB7,
+  0xBD, 0x5F, 0x9F, 0x3E, 0x4E, 0x1F, 0x26, 0xDB, 0x0C, 0x7A, 0x04, 0x7C, 0x2C, 0x38, 0x13, 0xD4,
+  0x02, 0x69, 0x09, 0x00, 0x00, 0x00, 0x00, 0x21, 0x08, 0x00, 0x08, 0x00, 0x08, 0x01, 0x08, 0x01,
+  0x08, 0x00, 0x08, 0x21, 0x00, 0x21, 0x00, 0x42, 0x00, 0x00, 0xFF, 0x5D, 0xCF, 0xBF, 0xA7, 0x9E,
+  0x2E, 0x3E, 0x1E, 0x1F, 0x26, 0x1B, 0x05, 0x3F, 0x5E, 0x18, 0x04, 0x37, 0x03, 0x3F, 0x45, 0x33,
+  0x02, 0xEF, 0x11, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0xDC, 0xC6, 0xFF, 0xD7, 0x5D, 0x6F, 0xBF,
+  0x2E, 0x3D, 0x4E, 0x5A, 0x4D, 0xBC, 0x15, 0x7A, 0x3C, 0xFB, 0x5D, 0x37, 0x34, 0xD7, 0x02, 0x55,
+  0x02, 0xFE, 0x54, 0xAD, 0x11, 0x43, 0x00, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+  0x08, 0x41, 0x00, 0x20, 0x00, 0x62, 0x08, 0x16, 0x7D, 0x7F, 0xB7, 0x9B, 0xA6, 0x9B, 0x96, 0xB0,
+  0x53, 0xB5, 0xAD, 0xDC, 0xAE, 0xDD, 0x25, 0x3C, 0x5D, 0xB6, 0xAD, 0x6D, 0x83, 0x1C, 0xA6, 0x74,
+  0x3B, 0xB2, 0x12, 0x34, 0x1B, 0xCC, 0x09, 0x01, 0x00, 0x00, 0x00, 0x22, 0x00, 0x01, 0x00, 0x00,
+  0x08, 0x01, 0x00, 0x20, 0x00, 0x64, 0x10, 0xFC, 0x6D, 0x9A, 0x65, 0x7B, 0xAE, 0x5F, 0xE7, 0xE7,
+  0x18, 0x06, 0x32, 0x76, 0x5D, 0x9E, 0x15, 0xDC, 0x34, 0x91, 0x53, 0xE5, 0x18, 0x58, 0x8D, 0xFF,
+  0xD7, 0xFA, 0x74, 0x1B, 0x34, 0x11, 0x02, 0x63, 0x00, 0x20, 0x08, 0x01, 0x00, 0x02, 0x08, 0x00,
+  0x00, 0x00, 0x08, 0x22, 0x08, 0x97, 0x3C, 0xBD, 0x35, 0x5E, 0x56, 0x3D, 0x76, 0x18, 0x2D, 0x5B,
+  0x0D, 0x5A, 0x25, 0x9C, 0x35, 0x5B, 0x15, 0xDF, 0x3D, 0xBC, 0x24, 0x97, 0x1B, 0xD9, 0x54, 0x36,
+  0x54, 0x5F, 0x7E, 0x52, 0x02, 0x3B, 0x3C, 0x2E, 0x12, 0x00, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
+  0x08, 0x20, 0x00, 0x04, 0x00, 0x19, 0x14, 0xFC, 0x24, 0x57, 0x14, 0xB9, 0x3C, 0x1A, 0x2D, 0xBC,
+  0x2D, 0xFD, 0x3D, 0xBD, 0x4D, 0x7B, 0x4D, 0x7A, 0x55, 0x7B, 0x4D, 0xFF, 0xDB, 0x4C, 0xDB, 0x6C,
+  0xD6, 0x3B, 0x73, 0x23, 0x13, 0x33, 0xF6, 0x0A, 0xD3, 0x0A, 0x20, 0x00, 0x20, 0x08, 0x22, 0x00,
+  0x00, 0x08, 0x20, 0x00, 0x6F, 0x1A, 0x37, 0x13, 0x18, 0x34, 0x5B, 0x6D, 0x7E, 0x96, 0x1F, 0xBF,
+  0x1D, 0xE7, 0x7E, 0xEF, 0x5E, 0xE7, 0xBF, 0xEF, 0x7E, 0xE7, 0x9D, 0xEF, 0x9E, 0xF7, 0x5E, 0xEF,
+  0xDF, 0xC7, 0xDF, 0xBE, 0x7A, 0x7D, 0xBB, 0x4C, 0x34, 0x2B, 0x22, 0x00, 0x00, 0x08, 0x02, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x4F, 0x12, 0xD5, 0x12, 0x9A, 0x4C, 0xFB, 0x9D, 0xBE, 0xD7, 0xDF, 0xE7,
+  0xDF, 0xFF, 0x7F, 0xFF, 0x9F, 0xFF, 0x9F, 0xEF, 0xFF, 0xEF, 0xBF, 0xEF, 0xFE, 0xF7, 0xDC, 0xEF,
+  0xFE, 0xF7, 0x7F, 0xD7, 0x57, 0x75, 0x17, 0x3C, 0x55, 0x3B, 0x02, 0x00, 0x00, 0x10, 0x01, 0x00,
+  0x01, 0x00, 0x01, 0x10, 0x4D, 0x1A, 0x74, 0x0A, 0x58, 0x2B, 0xF6, 0x6C, 0xFE, 0xE7, 0xDF, 0xEF,
+  0xBE, 0xE7, 0x9F, 0xE7, 0xDF, 0xE7, 0x7E, 0xE7, 0x9F, 0xD7, 0x7E, 0xE7, 0x5D, 0xE7, 0x9E, 0xEF,
+  0xBF, 0xEF, 0x7F, 0xD7, 0x34, 0x74, 0x92, 0x02, 0xDA, 0x44, 0x02, 0x00, 0x00, 0x08, 0x61, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x44, 0x00, 0x33, 0x0A, 0x77, 0x12, 0x93, 0x3B, 0xDB, 0xC6, 0xFE, 0xE6,
+  0xFD, 0xD6, 0x7F, 0xD7, 0xFC, 0xB6, 0x1D, 0xCF, 0xFC, 0xBE, 0xBA, 0xCE, 0xFC, 0xD6, 0xDF, 0xD6,
+  0x9F, 0xD7, 0xFA, 0xAD, 0x34, 0x53, 0x58, 0x0B, 0x7C, 0x4D, 0x00, 0x00, 0x20, 0x08, 0x40, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x03, 0x00, 0x11, 0x0A, 0x13, 0x02, 0xEF, 0x11, 0x16, 0x8D, 0x5E, 0xE7,
+  0x3F, 0xDF, 0x1F, 0xDF, 0x9F, 0xE7, 0x7E, 0xEF, 0xDF, 0xDF, 0x5F, 0xE7, 0x5E, 0xDF, 0x9F, 0xCF,
+  0x3D, 0xE7, 0xB6, 0x7C, 0xB3, 0x02, 0xFC, 0x13, 0xBE, 0x8D, 0x40, 0x00, 0xC8, 0x20, 0x00, 0x21,
+  0x00, 0x43, 0x00, 0x00, 0x00, 0x01, 0x08, 0x2B, 0x01, 0x34, 0x02, 0x32, 0x02, 0x6F, 0x2A, 0xBD,
+  0xC6, 0xDF, 0xDF, 0x5F, 0xD7, 0x7F, 0xD7, 0x7F, 0xCF, 0x7F, 0xD7, 0x5E, 0xDF, 0x7D, 0xD7, 0xFE,
+  0xD7, 0x7E, 0xCE, 0x16, 0x2B, 0x1C, 0x04, 0x9F, 0x45, 0x25, 0x00, 0x20, 0x08, 0x40, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x44, 0x08, 0x0F, 0x12, 0x53, 0x02, 0x53, 0x02, 0x91,
+  0x22, 0x1A, 0xA6, 0x5F, 0xD7, 0x7E, 0xCF, 0xBE, 0xCF, 0x9F, 0xCF, 0x5F, 0xD7, 0x5F, 0xCF, 0xDE,
+  0xA6, 0x99, 0x3C, 0x1B, 0x04, 0x3F, 0x35, 0x11, 0x33, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
+  0x08, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x30, 0x0A, 0xD7, 0x02, 0x75,
+  0x02, 0xB2, 0x01, 0xB4, 0x2A, 0x78, 0x64, 0xF8, 0x6C, 0x1A, 0x6D, 0x7B, 0x5C, 0xDB, 0x33, 0x38,
+  0x03, 0x1C, 0x04, 0x1F, 0x36, 0x96, 0x4C, 0x01, 0x00, 0x40, 0x08, 0x21, 0x00, 0x00, 0x08, 0x42,
+  0x00, 0x00, 0xA8, 0x41, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA5, 0x18, 0x75, 0x43, 0xDA, 0x23, 0x5D,
+  0x03, 0x5B, 0x03, 0x5A, 0x03, 0x7A, 0x0B, 0x1A, 0x03, 0x3B, 0x03, 0x3B, 0x03, 0xFF, 0x24, 0x5F,
+  0x55, 0xB0, 0x33, 0xE2, 0x08, 0x21, 0x08, 0x01, 0x00, 0x20, 0x08, 0x00, 0x08, 0x20, 0x00, 0x21,
+  0x00, 0x01, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x42, 0x00, 0x8B, 0x19, 0x18,
+  0x24, 0x3C, 0x25, 0xFD, 0x0C, 0x3D, 0x0C, 0x7F, 0x24, 0xFF, 0x34, 0xBD, 0x5D, 0xF4, 0x43, 0x06,
+  0x11, 0x01, 0x00, 0x01, 0x00, 0x43, 0x00, 0x00, 0xB0, 0x02, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x42, 0x00, 0xA7, 0x01, 0xEE,
+  0x1A, 0x11, 0x2B, 0xF1, 0x2A, 0xCF, 0x22, 0xC3, 0x00, 0x00, 0x08, 0x01, 0x08, 0x21, 0x00, 0x22,
+  0x00, 0x42, 0x00, 0x00, 0x00, 0x20, 0x08, 0x01, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x21, 0x08, 0x00, 0x08, 0x00, 0x18, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x08, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x61, 0x00, 0x20,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x80, 0x21, 0x00, 0x00,
+  0x90, 0x21, 0x00, 0x21, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x20, 0x00, 0x20, 0x08, 0x01,
+  0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x08, 0x20, 0x00, 0x00, 0x08, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x82, 0x41, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0xE8, 0x03, 0x36, 0x02,
+  0x00, 0x60, 0x00, 0x00, 0x82, 0x07, 0x42, 0xDD, 0xFF, 0x57, 0xCE, 0x00, 0x50, 0x00, 0x00, 0x81,
+  0xBB, 0xFF, 0x56, 0xFF, 0x44, 0x01, 0xE5, 0x81, 0x64, 0xE5, 0x99, 0xFF, 0x4C, 0x00, 0x00, 0x81,
+  0x33, 0xAD, 0xD1, 0xF6, 0x49, 0x01, 0xE5, 0x80, 0x9A, 0xFF, 0x00, 0x48, 0x00, 0x00, 0x80, 0xBB,
+  0xFF, 0x4C, 0x01, 0xE5, 0x80, 0x57, 0xFF, 0x47, 0x00, 0x00, 0x83, 0xDC, 0xFF, 0x01, 0xE5, 0x01,
+  0xE5, 0x01, 0xDD, 0x48, 0x01, 0xE5, 0x83, 0x01, 0xDD, 0x01, 0xE5, 0x01, 0xE5, 0x78, 0xFF, 0x00,
+  0x45, 0x00, 0x00, 0x81, 0x01, 0xE5, 0x01, 0xDD, 0x44, 0x01, 0xE5, 0x87, 0x02, 0xE5, 0x01, 0xE5,
+  0x01, 0xE5, 0x01, 0xDD, 0x01, 0xDD, 0x01, 0xE5, 0x01, 0xE5, 0x01, 0xDD, 0x42, 0x01, 0xE5, 0x44,
+  0x00, 0x00, 0x85, 0x99, 0xFF, 0x01, 0xE5, 0x02, 0xE5, 0x01, 0xE5, 0x69, 0x4A, 0x6A, 0x4A, 0x45,
+  0x01, 0xE5, 0x80, 0x02, 0xE5, 0x44, 0x01, 0xE5, 0x80, 0x01, 0xDD, 0x00, 0x43, 0x00, 0x00, 0x42,
+  0x01, 0xE5, 0x43, 0x00, 0x00, 0x82, 0xB2, 0x94, 0x01, 0xE5, 0x02, 0xE5, 0x43, 0x01, 0xE5, 0x80,
+  0x01, 0xDD, 0x44, 0x01, 0xE5, 0x42, 0x00, 0x00, 0x80, 0xDC, 0xFF, 0x42, 0x01, 0xE5, 0x84, 0x00,
+  0x00, 0x69, 0x4A, 0x02, 0xE5, 0x69, 0x4A, 0x00, 0x00, 0x44, 0x01, 0xE5, 0x82, 0x69, 0x4A, 0x00,
+  0x00, 0x00, 0x00, 0x42, 0x01, 0xE5, 0x80, 0x58, 0xFF, 0x42, 0x00, 0x00, 0x80, 0x9A, 0xFF, 0x46,
+  0x01, 0xE5, 0x80, 0xB3, 0x94, 0x42, 0x01, 0xE5, 0x88, 0x02, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x69,
+  0x4A, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE5, 0x01, 0xE5, 0xA7, 0xE5, 0x42, 0x00, 0x00, 0x80, 0x79,
+  0xFF, 0x44, 0x01, 0xE5, 0x80, 0x01, 0xDD, 0x44, 0x01, 0xE5, 0x81, 0x02, 0xE5, 0xB2, 0x94, 0x42,
+  0x01, 0xE5, 0x83, 0x00, 0x00, 0x01, 0xDD, 0x01, 0xDD, 0x01, 0xE5, 0x42, 0x00, 0x00, 0x89, 0x79,
+  0xFF, 0x01, 0xE5, 0x01, 0xE5, 0x31, 0xFE, 0x91, 0xFD, 0xB0, 0xF5, 0xF1, 0xF5, 0xEC, 0xF5, 0x01,
+  0xE5, 0x01, 0xDD, 0x47, 0x01, 0xE5, 0x82, 0x02, 0xE5, 0x01, 0xE5, 0x01, 0xE5, 0x42, 0x00, 0x00,
+  0x84, 0x9A, 0xFF, 0x01, 0xE5, 0x01, 0xE5, 0x31, 0xFE, 0xD0, 0xF4, 0x42, 0x00, 0xF8, 0x87, 0x4D,
+  0xDC, 0xAE, 0xE4, 0x0F, 0xE5, 0x90, 0xED, 0x52, 0xFE, 0x01, 0xE5, 0x01, 0xE5, 0x02, 0xE5, 0x43,
+  0x01, 0xE5, 0x80, 0xA7, 0xED, 0x42, 0x00, 0x00, 0x84, 0xDC, 0xFF, 0x01, 0xE5, 0x01, 0xE5, 0x66,
+  0xED, 0x8E, 0xE4, 0x44, 0x00, 0xF8, 0x85, 0xAC, 0xDB, 0x0D, 0xE4, 0xF0, 0xF4, 0xF0, 0xF4, 0x30,
+  0xF5, 0x91, 0xFD, 0x43, 0x01, 0xE5, 0x80, 0x57, 0xFF, 0x43, 0x00, 0x00, 0x42, 0x01, 0xE5, 0x49,
+  0x00, 0xF8, 0x82, 0xF0, 0xF4, 0xB1, 0xFD, 0x01, 0xDD, 0x43, 0x01, 0xE5, 0x43, 0x00, 0x00, 0x82,
+  0x78, 0xFF, 0x01, 0xE5, 0x70, 0xED, 0x49, 0x00, 0xF8, 0x85, 0x50, 0xF5, 0x01, 0xE5, 0x01, 0xE5,
+  0x01, 0xDD, 0x01, 0xE5, 0x01, 0xE5, 0x45, 0x00, 0x00, 0x81, 0x01, 0xE5, 0x0E, 0xE5, 0x47, 0x00,
+  0xF8, 0x81, 0xF0, 0xF4, 0x50, 0xF5, 0x45, 0x01, 0xE5, 0x00, 0x44, 0x00, 0x00, 0x90, 0xBC, 0xFF,
+  0x90, 0xED, 0x0D, 0xDC, 0x0A, 0xE3, 0x00, 0xF8, 0x00, 0xF8, 0x0C, 0xDC, 0x6E, 0xE4, 0x10, 0xF5,
+  0x70, 0xF5, 0x11, 0xFE, 0x01, 0xE5, 0x02, 0xE5, 0x01, 0xDD, 0x01, 0xE5, 0x01, 0xE5, 0x77, 0xFF,
+  0x47, 0x00, 0x00, 0x85, 0x7A, 0xFF, 0xAE, 0xE4, 0xCB, 0xE3, 0x6A, 0xE3, 0xCC, 0xDB, 0x8E, 0xDC,
+  0x47, 0x01, 0xE5, 0x80, 0x57, 0xFF, 0x49, 0x00, 0x00, 0x8C, 0x9C, 0xFF, 0xD2, 0xED, 0x2F, 0xED,
+  0xB0, 0xED, 0x01, 0xDD, 0x01, 0xE5, 0x01, 0xE5, 0x01, 0xDD, 0x01, 0xE5, 0x21, 0xE5, 0x01, 0xE5,
+  0x01, 0xE5, 0x99, 0xFF, 0x4C, 0x00, 0x00, 0x81, 0xBB, 0xFF, 0x55, 0xFF, 0x43, 0x01, 0xE5, 0x82,
+  0x02, 0xE5, 0x01, 0xE5, 0x79, 0xFF, 0x51, 0x00, 0x00, 0x83, 0x5B, 0xEF, 0x01, 0xE5, 0x01, 0xE5,
+  0x03, 0x21, 0x00, 0x60, 0x00, 0x00,
+};
@@ -0,0 +1,67 @@
+// NeoPixelBusGfx example for a 32 x 32 pixel matrix rendering a plasma in
+// bands. On an ESP32 the bands are drawn on both cores at the same time,
+// the time per frame for 1, 2 and 4 bands is printed to compare.
+
+#include <NeoPixelBusGfx.h>
+#include <NeoPixelBus.h>
+
+// Pins are method specific. See https://github.com/Makuna/NeoPixelBus/wiki/NeoPixelBus-object-API
+#define DATA_PIN 2
+
+#define WIDTH 32
+#define HEIGHT 32
+
+// See NeoPixelBus documentation for choosing the correct Feature and Method
+// (https://github.com/Makuna/NeoPixelBus/wiki/NeoPixelBus-object)
+NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> matrix(WIDTH, HEIGHT, DATA_PIN);
+
+// See NeoPixelBus documentation for choosing the correct NeoTopology
+// (https://github.com/Makuna/NeoPixelBus/wiki/Matrix-Panels-Support)
+NeoTopology<ColumnMajorAlternating180Layout> topo(WIDTH, HEIGHT);
+
+uint16_t remap(uint16_t x, uint16_t y) {
+  return topo.Map(x, y);
+}
+
+float t = 0;
+
+// Draws only the rows of the band, everything else would be clipped anyway.
+void plasma(Adafruit_GFX& gfx, int16_t y0, int16_t h) {
+  for(int16_t y = y0; y < y0 + h; y++) {
+    for(int16_t x = 0; x < gfx.width(); x++) {
+      float v = sinf(x * 0.3f + t) + sinf(y * 0.2f - t) + sinf((x + y) * 0.15f + t) + sinf(sqrtf(x * x + y * y) * 0.25f);
+      uint8_t c = (v + 4) * 31;
+      gfx.drawPixel(x, y, matrix.Color(c, 255 - c, c / 2));
+    }
+  }
+}
+
+uint8_t bands = 1;
+uint16_t frames = 0;
+unsigned long renderMicros = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  matrix.Begin();
+  matrix.setRemapFunction(&remap);
+}
+
+void loop() {
+  unsigned long start = micros();
+  matrix.renderBands(&plasma, bands);
+  renderMicros += micros() - start;
+  matrix.Show();
+  t += 0.05f;
+
+  if(++frames == 100) {
+    Serial.print(bands);
+    Serial.print(F(" bands: "));
+    Serial.print(renderMicros / frames);
+    Serial.println(F("us per frame"));
+
+    bands = bands == 4 ? 1 : bands * 2;
+    frames = 0;
+    renderMicros = 0;
+  }
+}
@@ -0,0 +1,74 @@
+// NeoPixelBusGfx example for a 32 x 8 pixel matrix running at a fixed frame rate.
+// Instead of delay() the frames are paced by update(), which calls render()
+// 50 times per second with the time since the last frame. The text moves
+// with the elapsed time, so it keeps its speed even if frames are dropped.
+
+#include <NeoPixelBusGfx.h>
+#include <NeoPixelBus.h>
+
+// Pins are method specific. See https://github.com/Makuna/NeoPixelBus/wiki/NeoPixelBus-object-API
+#define DATA_PIN 2
+
+#define WIDTH 32
+#define HEIGHT 8
+
+// pixels per second
+#define SPEED 12
+
+// See NeoPixelBus documentation for choosing the correct Feature and Method
+// (https://github.com/Makuna/NeoPixelBus/wiki/NeoPixelBus-object)
+NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> matrix(WIDTH, HEIGHT, DATA_PIN);
+
+// See NeoPixelBus documentation for choosing the correct NeoTopology
+// (https://github.com/Makuna/NeoPixelBus/wiki/Matrix-Panels-Support)
+NeoTopology<ColumnMajorAlternating180Layout> topo(WIDTH, HEIGHT);
+
+uint16_t remap(uint16_t x, uint16_t y) {
+  return topo.Map(x, y);
+}
+
+// position of the text in 1/1000000 pixels
+int32_t position = (int32_t)WIDTH * 1000000;
+
+void render(uint32_t deltaMicros) {
+  position -= (int32_t)deltaMicros * SPEED;
+  if(position < -36L * 1000000) position = (int32_t)WIDTH * 1000000;
+
+  matrix.fillScreen(0);
+  matrix.setCursor(position / 1000000, 0);
+  matrix.print(F("Howdy"));
+}
+
+void setup() {
+  Serial.begin(115200);
+
+  matrix.Begin();
+  matrix.setRemapFunction(&remap);
+  matrix.setTextWrap(false);
+  matrix.setTextColor(matrix.Color(0, 64, 255));
+
+  matrix.setRenderCallback(&render);
+  matrix.setFrameRate(50);
+}
+
+unsigned long lastReport = 0;
+
+void loop() {
+  matrix.update();
+
+  // anything else can run here while no frame is due
+  if(millis() - lastReport >= 1000) {
+    lastReport = millis();
+
+    const NeoGfxFrameStats& stats = matrix.getFrameStats();
+    Serial.print(F("fps: "));
+    Serial.print(stats.fps);
+    Serial.print(F(" skipped: "));
+    Serial.print(stats.skipped);
+    Serial.print(F(" jitter: "));
+    Serial.print(stats.jitterMicros);
+    Serial.print(F("us max: "));
+    Serial.print(stats.maxJitterMicros);
+    Serial.println(F("us"));
+  }
+}
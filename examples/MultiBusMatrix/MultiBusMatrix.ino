@@ -0,0 +1,50 @@
+// NeoPixelMultiBusGfx example: one 32x64 matrix driven by 4 data lines.
+// Each line drives a 32x16 strip of the matrix, so a frame takes a
+// quarter of the time of a single 2048 pixel strip.
+
+#include <NeoPixelMultiBusGfx.h>
+#include <NeoPixelBus.h>
+
+#define WIDTH 32
+#define HEIGHT 64
+#define BUS_COUNT 4
+
+// Pins are method specific. See https://github.com/Makuna/NeoPixelBus/wiki/NeoPixelBus-object-API
+const uint8_t pins[BUS_COUNT] = { 12, 13, 14, 15 };
+
+// See NeoPixelBus documentation for choosing the correct Feature and Method
+// (https://github.com/Makuna/NeoPixelBus/wiki/NeoPixelBus-object)
+// The method has to send asynchronously (e.g. I2S or RMT on the ESP32) for
+// the lines to be sent in parallel.
+NeoPixelMultiBusGfx<NeoGrbFeature, Neo800KbpsMethod, BUS_COUNT> matrix(WIDTH, HEIGHT, pins);
+
+// See NeoPixelBus documentation for choosing the correct NeoTopology
+// (https://github.com/Makuna/NeoPixelBus/wiki/Matrix-Panels-Support)
+// The topology is the one of a single strip.
+NeoTopology<RowMajorAlternatingLayout> topo(WIDTH, HEIGHT / BUS_COUNT);
+
+uint16_t remap(uint16_t x, uint16_t y) {
+  return topo.Map(x, y);
+}
+
+int16_t row = 0;
+
+void setup() {
+  matrix.Begin();
+  matrix.setRemapFunction(&remap);
+  matrix.setTextWrap(false);
+}
+
+void loop() {
+  matrix.fillScreen(0);
+  matrix.fillRect(0, row, WIDTH, 8, matrix.Color(0, 0, 64));
+  matrix.setCursor(1, row);
+  matrix.setTextColor(matrix.Color(255, 255, 255));
+  matrix.print("Hi!");
+
+  // only the lines with changed pixels are sent
+  matrix.ShowIfDirty();
+
+  row = (row + 1) % HEIGHT;
+  delay(20);
+}
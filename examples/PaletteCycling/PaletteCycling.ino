@@ -0,0 +1,51 @@
+// NeoPixelBusGfx example for a 32 x 8 pixel matrix with indexed colors.
+// The rings are drawn once with palette indices, the animation only
+// rotates the palette, so nothing has to be redrawn.
+
+#include <NeoPixelBusGfx.h>
+#include <NeoPixelBus.h>
+
+// Pins are method specific. See https://github.com/Makuna/NeoPixelBus/wiki/NeoPixelBus-object-API
+#define DATA_PIN 2
+
+#define WIDTH 32
+#define HEIGHT 8
+
+// number of palette entries cycled
+#define COLORS 15
+
+// See NeoPixelBus documentation for choosing the correct Feature and Method
+// (https://github.com/Makuna/NeoPixelBus/wiki/NeoPixelBus-object)
+NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> matrix(WIDTH, HEIGHT, DATA_PIN);
+
+// See NeoPixelBus documentation for choosing the correct NeoTopology
+// (https://github.com/Makuna/NeoPixelBus/wiki/Matrix-Panels-Support)
+NeoTopology<ColumnMajorAlternating180Layout> topo(WIDTH, HEIGHT);
+
+uint16_t remap(uint16_t x, uint16_t y) {
+  return topo.Map(x, y);
+}
+
+void setup() {
+  matrix.Begin();
+  matrix.setRemapFunction(&remap);
+
+  // 4 bits per pixel: 16 colors, 128 bytes for the whole matrix
+  if(!matrix.enableIndexedColor(4)) return;
+
+  // index 0 stays black, 1 to 15 get a color wheel
+  for(uint8_t i = 0; i < COLORS; i++) {
+    matrix.setPaletteColor(1 + i, HslColor(i / (float)COLORS, 1.0f, 0.25f));
+  }
+
+  // rings around the center, each with the next index
+  for(int16_t r = 40; r > 0; r--) {
+    matrix.fillCircle(WIDTH / 2, HEIGHT / 2, r, 1 + r % COLORS);
+  }
+}
+
+void loop() {
+  matrix.cyclePalette(1, COLORS);
+  matrix.Show();
+  delay(60);
+}
@@ -0,0 +1,61 @@
+// NeoPixelBusGfx example for a 32 x 8 pixel matrix on a power supply of
+// 2 A. The current of every frame is estimated while drawing and the
+// brightness is scaled down when a frame would draw more than the limit.
+// The estimate is printed for telemetry.
+
+#include <NeoPixelBusGfx.h>
+#include <NeoPixelBus.h>
+
+// Pins are method specific. See https://github.com/Makuna/NeoPixelBus/wiki/NeoPixelBus-object-API
+#define DATA_PIN 2
+
+#define WIDTH 32
+#define HEIGHT 8
+
+// what the LEDs may draw, leaving some of the 2 A for the controller
+#define POWER_LIMIT 1800
+
+// See NeoPixelBus documentation for choosing the correct Feature and Method
+// (https://github.com/Makuna/NeoPixelBus/wiki/NeoPixelBus-object)
+NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> matrix(WIDTH, HEIGHT, DATA_PIN);
+
+// See NeoPixelBus documentation for choosing the correct NeoTopology
+// (https://github.com/Makuna/NeoPixelBus/wiki/Matrix-Panels-Support)
+NeoTopology<ColumnMajorAlternating180Layout> topo(WIDTH, HEIGHT);
+
+uint16_t remap(uint16_t x, uint16_t y) {
+  return topo.Map(x, y);
+}
+
+int16_t size = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  matrix.Begin();
+  matrix.setRemapFunction(&remap);
+
+  // uA of a fully lit red, green, blue and white channel and of a dark
+  // pixel, measure your LEDs for a better estimate
+  matrix.enablePowerEstimate(NeoGfxPowerModel(16000, 12000, 12000, 0, 800));
+  if(!matrix.setPowerLimit(POWER_LIMIT)) {
+    Serial.println("not enough memory for the back buffer");
+  }
+}
+
+void loop() {
+  // a white square growing over the matrix, at full size it would draw
+  // about 9 A
+  matrix.fillScreen(0);
+  matrix.fillRect(WIDTH / 2 - size, HEIGHT / 2 - size / 4, 2 * size, size / 2, matrix.Color(255, 255, 255));
+  size = (size + 1) % (WIDTH / 2 + 1);
+
+  Serial.print(matrix.getPowerDemand());
+  Serial.print(" mA wanted, ");
+  Serial.print(matrix.getPowerEstimate());
+  Serial.print(" mA shown, brightness ");
+
+  matrix.present();
+  Serial.println(matrix.getPowerLimitBrightness());
+  delay(100);
+}
@@ -0,0 +1,164 @@
+// NeoPixelBusGfx benchmark for the Adafruit_GFX primitives.
+// Times every primitive for all rotations, with and without a remap
+// function, for different features and matrix sizes and prints the
+// results as CSV to Serial, so they can be compared between versions:
+//
+//   bus,feature,width,height,rotation,remap,primitive,calls,us,per_second
+//
+// Nothing is shown on the matrix, so it can run without leds attached.
+// The 128x64 matrix needs about 32KB of RAM for the RGBW pixels, so it
+// is skipped on AVR.
+// The same benchmark runs on the host against the mock bus, see
+// test/bench_suite.cpp.
+
+#include <NeoPixelBusGfx.h>
+#include <NeoPixelBrightnessBusGfx.h>
+#include <NeoPixelBus.h>
+#include <NeoPixelBrightnessBus.h>
+
+// Pins are method specific. See https://github.com/Makuna/NeoPixelBus/wiki/NeoPixelBus-object-API
+#define DATA_PIN 2
+
+// Each primitive runs at least this long
+#define MIN_TIME_US 200000UL
+
+uint16_t remapWidth, remapHeight;
+
+uint16_t remap(uint16_t x, uint16_t y) {
+  return RowMajorAlternatingLayout::Map(remapWidth, remapHeight, x, y);
+}
+
+// 8x8 bitmap, the colors don't matter
+const uint16_t PROGMEM bitmap[64] = {
+  0xF800, 0x07E0, 0x001F, 0xFFFF, 0xF800, 0x07E0, 0x001F, 0xFFFF,
+  0x07E0, 0x001F, 0xFFFF, 0xF800, 0x07E0, 0x001F, 0xFFFF, 0xF800,
+  0x001F, 0xFFFF, 0xF800, 0x07E0, 0x001F, 0xFFFF, 0xF800, 0x07E0,
+  0xFFFF, 0xF800, 0x07E0, 0x001F, 0xFFFF, 0xF800, 0x07E0, 0x001F,
+  0xF800, 0x07E0, 0x001F, 0xFFFF, 0xF800, 0x07E0, 0x001F, 0xFFFF,
+  0x07E0, 0x001F, 0xFFFF, 0xF800, 0x07E0, 0x001F, 0xFFFF, 0xF800,
+  0x001F, 0xFFFF, 0xF800, 0x07E0, 0x001F, 0xFFFF, 0xF800, 0x07E0,
+  0xFFFF, 0xF800, 0x07E0, 0x001F, 0xFFFF, 0xF800, 0x07E0, 0x001F };
+
+enum Primitive {
+  DRAW_PIXEL, FILL_SCREEN, DRAW_LINE, FILL_RECT, FILL_CIRCLE, PRINT, DRAW_RGB_BITMAP, PRIMITIVE_COUNT
+};
+
+const char* primitiveNames[PRIMITIVE_COUNT] = {
+  "drawPixel", "fillScreen", "drawLine", "fillRect", "fillCircle", "print", "drawRGBBitmap"
+};
+
+void drawPrimitive(Adafruit_GFX& gfx, uint8_t primitive, uint16_t n) {
+  int16_t w = gfx.width();
+  int16_t h = gfx.height();
+  uint16_t color = n * 0x1111;
+
+  switch(primitive) {
+  case DRAW_PIXEL:
+    gfx.drawPixel(n % w, (n / w) % h, color);
+    break;
+  case FILL_SCREEN:
+    gfx.fillScreen(color);
+    break;
+  case DRAW_LINE:
+    gfx.drawLine(0, n % h, w - 1, h - 1 - n % h, color);
+    break;
+  case FILL_RECT:
+    gfx.fillRect(n % 4, n % 3, w / 2, h / 2, color);
+    break;
+  case FILL_CIRCLE:
+    gfx.fillCircle(w / 2, h / 2, min(w, h) / 2, color);
+    break;
+  case PRINT:
+    gfx.setCursor(0, 0);
+    gfx.setTextColor(color, 0);
+    gfx.print("Hello");
+    break;
+  case DRAW_RGB_BITMAP:
+    gfx.drawRGBBitmap(n % w - 4, n % h - 4, bitmap, 8, 8);
+    break;
+  }
+}
+
+void report(const char* bus, const char* feature, uint16_t w, uint16_t h, uint8_t rotation, bool withRemap, uint8_t primitive, uint32_t calls, uint32_t us) {
+  Serial.print(bus);
+  Serial.print(',');
+  Serial.print(feature);
+  Serial.print(',');
+  Serial.print(w);
+  Serial.print(',');
+  Serial.print(h);
+  Serial.print(',');
+  Serial.print(rotation);
+  Serial.print(',');
+  Serial.print(withRemap ? 1 : 0);
+  Serial.print(',');
+  Serial.print(primitiveNames[primitive]);
+  Serial.print(',');
+  Serial.print(calls);
+  Serial.print(',');
+  Serial.print(us);
+  Serial.print(',');
+  Serial.println((float)calls * 1000000.0f / us, 1);
+}
+
+template<typename T_GFX>
+void benchmark(const char* bus, const char* feature, uint16_t w, uint16_t h) {
+  T_GFX* matrix = new T_GFX(w, h, DATA_PIN);
+  matrix->Begin();
+  matrix->setTextWrap(false);
+
+  remapWidth  = w;
+  remapHeight = h;
+
+  for(uint8_t withRemap=0; withRemap<2; withRemap++) {
+    matrix->setRemapFunction(withRemap ? &remap : NULL);
+
+    for(uint8_t rotation=0; rotation<4; rotation++) {
+      matrix->setRotation(rotation);
+
+      for(uint8_t primitive=0; primitive<PRIMITIVE_COUNT; primitive++) {
+        uint32_t calls = 0;
+        unsigned long start = micros();
+        unsigned long us;
+
+        do {
+          for(uint8_t i=0; i<16; i++) {
+            drawPrimitive(*matrix, primitive, calls++);
+          }
+          us = micros() - start;
+        } while(us < MIN_TIME_US);
+
+        report(bus, feature, w, h, rotation, withRemap, primitive, calls, us);
+        yield();
+      }
+    }
+  }
+
+  delete matrix;
+}
+
+template<typename T_FEATURE>
+void benchmarkSizes(const char* feature) {
+  benchmark<NeoPixelBusGfx<T_FEATURE, Neo800KbpsMethod>>("NeoPixelBus", feature, 8, 32);
+  benchmark<NeoPixelBusGfx<T_FEATURE, Neo800KbpsMethod>>("NeoPixelBus", feature, 24, 24);
+  benchmark<NeoPixelBrightnessBusGfx<T_FEATURE, Neo800KbpsMethod>>("NeoPixelBrightnessBus", feature, 8, 32);
+  benchmark<NeoPixelBrightnessBusGfx<T_FEATURE, Neo800KbpsMethod>>("NeoPixelBrightnessBus", feature, 24, 24);
+#ifndef __AVR__
+  benchmark<NeoPixelBusGfx<T_FEATURE, Neo800KbpsMethod>>("NeoPixelBus", feature, 128, 64);
+  benchmark<NeoPixelBrightnessBusGfx<T_FEATURE, Neo800KbpsMethod>>("NeoPixelBrightnessBus", feature, 128, 64);
+#endif
+}
+
+void setup() {
+  Serial.begin(115200);
+  while(!Serial); // wait for the serial monitor
+}
+
+void loop() {
+  Serial.println("bus,feature,width,height,rotation,remap,primitive,calls,us,per_second");
+  benchmarkSizes<NeoGrbFeature>("NeoGrbFeature");
+  benchmarkSizes<NeoGrbwFeature>("NeoGrbwFeature");
+  Serial.println();
+
+  delay(10000);
+}
@@ -0,0 +1,48 @@
+// NeoPixelBusGfx example showing frames sent by a host over serial.
+// The host sends packets of the frame stream (see feedStream in NeoGfx.h),
+// e.g. one packet per frame with all pixels in x/y order:
+//   'N' 'G' 0x05 3 0 0 count_low count_high r g b r g b ...
+// (flags 0x05 = NeoGfxStreamRemap | NeoGfxStreamEndOfFrame)
+// The bytes are written to the pixels as they arrive, there is no frame buffer.
+
+#include <NeoPixelBusGfx.h>
+#include <NeoPixelBus.h>
+
+// Pins are method specific. See https://github.com/Makuna/NeoPixelBus/wiki/NeoPixelBus-object-API
+#define DATA_PIN 2
+
+#define WIDTH 32
+#define HEIGHT 8
+
+// See NeoPixelBus documentation for choosing the correct Feature and Method
+// (https://github.com/Makuna/NeoPixelBus/wiki/NeoPixelBus-object)
+NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> matrix(WIDTH, HEIGHT, DATA_PIN);
+
+// See NeoPixelBus documentation for choosing the correct NeoTopology
+// (https://github.com/Makuna/NeoPixelBus/wiki/Matrix-Panels-Support)
+NeoTopology<ColumnMajorAlternating180Layout> topo(WIDTH, HEIGHT);
+
+uint16_t remap(uint16_t x, uint16_t y) {
+  return topo.Map(x, y);
+}
+
+uint8_t buffer[64];
+
+void setup() {
+  Serial.begin(921600);
+
+  matrix.Begin();
+  matrix.setRemapFunction(&remap);
+  matrix.Show();
+}
+
+void loop() {
+  size_t length = Serial.available();
+  if(length == 0) return;
+  if(length > sizeof(buffer)) length = sizeof(buffer);
+
+  length = Serial.readBytes(buffer, length);
+  if(matrix.feedStream(buffer, length)) {
+    matrix.Show();
+  }
+}
@@ -0,0 +1,91 @@
+// NeoPixelBusGfx benchmark for the span based drawing.
+// Fills the matrix once pixel by pixel through drawPixel and once with
+// fillRect / drawFastHLine / drawFastVLine and prints the timings to Serial.
+// Nothing is shown on the matrix, so it can run without leds attached.
+
+#include <NeoPixelBusGfx.h>
+#include <NeoPixelBus.h>
+
+// Pins are method specific. See https://github.com/Makuna/NeoPixelBus/wiki/NeoPixelBus-object-API
+#define DATA_PIN 2
+
+#define WIDTH 64
+#define HEIGHT 32
+
+#define ROUNDS 20
+
+// See NeoPixelBus documentation for choosing the correct Feature and Method
+// (https://github.com/Makuna/NeoPixelBus/wiki/NeoPixelBus-object)
+NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> matrix(WIDTH, HEIGHT, DATA_PIN);
+
+// See NeoPixelBus documentation for choosing the correct NeoTopology
+// (https://github.com/Makuna/NeoPixelBus/wiki/Matrix-Panels-Support)
+NeoTopology<RowMajorAlternatingLayout> topo(WIDTH, HEIGHT);
+
+uint16_t remap(uint16_t x, uint16_t y) {
+  return topo.Map(x, y);
+}
+
+unsigned long perPixelRect() {
+  unsigned long start = micros();
+  for(int r=0; r<ROUNDS; r++) {
+    for(int16_t y=0; y<matrix.height(); y++) {
+      for(int16_t x=0; x<matrix.width(); x++) {
+        matrix.drawPixel(x, y, r & 1 ? 0xF800 : 0x001F);
+      }
+    }
+  }
+  return micros() - start;
+}
+
+unsigned long spanRect() {
+  unsigned long start = micros();
+  for(int r=0; r<ROUNDS; r++) {
+    matrix.fillRect(0, 0, matrix.width(), matrix.height(), r & 1 ? 0xF800 : 0x001F);
+  }
+  return micros() - start;
+}
+
+unsigned long spanLines() {
+  unsigned long start = micros();
+  for(int r=0; r<ROUNDS; r++) {
+    for(int16_t y=0; y<matrix.height(); y++) {
+      matrix.drawFastHLine(0, y, matrix.width(), 0x07E0);
+    }
+    for(int16_t x=0; x<matrix.width(); x++) {
+      matrix.drawFastVLine(x, 0, matrix.height(), 0xFFE0);
+    }
+  }
+  return micros() - start;
+}
+
+void report(const char* name, unsigned long us) {
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print(us / ROUNDS);
+  Serial.println(" us per frame");
+}
+
+void setup() {
+  Serial.begin(115200);
+  matrix.Begin();
+  matrix.setRemapFunction(&remap);
+}
+
+void loop() {
+  for(uint8_t rotation=0; rotation<4; rotation++) {
+    matrix.setRotation(rotation);
+    Serial.print("rotation ");
+    Serial.println(rotation);
+
+    unsigned long pixel = perPixelRect();
+    unsigned long span  = spanRect();
+    report("  drawPixel  ", pixel);
+    report("  fillRect   ", span);
+    report("  h+v lines  ", spanLines());
+    Serial.print("  speedup    : ");
+    Serial.print((float)pixel / span);
+    Serial.println("x");
+  }
+  delay(5000);
+}
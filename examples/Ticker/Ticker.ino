@@ -0,0 +1,56 @@
+// NeoPixelBusGfx example for a ticker on a 32 x 8 pixel matrix.
+// Instead of clearing the matrix and printing the whole text every frame,
+// the content is moved one column to the left with scroll() and only the
+// character under the new column at the right border is drawn.
+
+#include <NeoPixelBusGfx.h>
+#include <NeoPixelBus.h>
+
+// Pins are method specific. See https://github.com/Makuna/NeoPixelBus/wiki/NeoPixelBus-object-API
+#define DATA_PIN 2
+
+#define WIDTH 32
+#define HEIGHT 8
+
+// width of a character of the default font, including the space
+#define CHAR_WIDTH 6
+
+// See NeoPixelBus documentation for choosing the correct Feature and Method
+// (https://github.com/Makuna/NeoPixelBus/wiki/NeoPixelBus-object)
+NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> matrix(WIDTH, HEIGHT, DATA_PIN);
+
+// See NeoPixelBus documentation for choosing the correct NeoTopology
+// (https://github.com/Makuna/NeoPixelBus/wiki/Matrix-Panels-Support)
+NeoTopology<ColumnMajorAlternating180Layout> topo(WIDTH, HEIGHT);
+
+uint16_t remap(uint16_t x, uint16_t y) {
+  return topo.Map(x, y);
+}
+
+const char text[] = "Howdy! ";
+
+// column of the text at the right border
+uint16_t column = 0;
+
+void setup() {
+  matrix.Begin();
+  matrix.setRemapFunction(&remap);
+  matrix.setTextWrap(false);
+
+  // transparent text, the scrolled in column is cleared by scroll()
+  matrix.setTextColor(matrix.Color(255, 128, 0));
+}
+
+void loop() {
+  matrix.scroll(-1, 0);
+
+  // The other columns of the character are already on the matrix, so
+  // drawing them again doesn't change anything.
+  matrix.setCursor(matrix.width() - 1 - column % CHAR_WIDTH, 0);
+  matrix.write(text[column / CHAR_WIDTH]);
+
+  if(++column >= CHAR_WIDTH * (sizeof(text) - 1)) column = 0;
+
+  matrix.ShowIfDirty();
+  delay(50);
+}
@@ -1,6 +1,8 @@
 #ifndef _GAMMA_H_
 #define _GAMMA_H_
 
+#include <stdint.h>
+
 #ifdef __AVR
  #include <avr/pgmspace.h>
 #elif defined(ESP8266)
@@ -9,8 +11,120 @@
  #ifndef PROGMEM
   #define PROGMEM
  #endif
+ #ifndef pgm_read_byte
+  #define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+ #endif
 #endif
 
+// The gamma tables are generated by the compiler. The gamma is given in
+// hundredths (e.g. 260 for 2.6), as floating point values can't be
+// template parameters.
+
+// ln(x) for x > 0: reduce x to [0.5, 1] and use the series of
+// 2 * atanh((x - 1) / (x + 1)).
+constexpr double neoGfxLnSeries(double z2, double term, int n) {
+  return n > 41 ? 0.0 : term / n + neoGfxLnSeries(z2, term * z2, n + 2);
+}
+
+constexpr double neoGfxLn(double x) {
+  return x < 0.5 ? neoGfxLn(x * 2.0) - 0.69314718055994531 :
+         x > 1.0 ? neoGfxLn(x / 2.0) + 0.69314718055994531 :
+         2.0 * neoGfxLnSeries(((x - 1.0) / (x + 1.0)) * ((x - 1.0) / (x + 1.0)), (x - 1.0) / (x + 1.0), 1);
+}
+
+// e^y for y <= 0: halve y until the Taylor series converges fast.
+constexpr double neoGfxExpSeries(double y, double term, int n) {
+  return n > 20 ? term : term + neoGfxExpSeries(y, term * y / n, n + 1);
+}
+
+constexpr double neoGfxSquare(double v) {
+  return v * v;
+}
+
+constexpr double neoGfxExp(double y) {
+  return y < -0.5 ? neoGfxSquare(neoGfxExp(y / 2.0)) : neoGfxExpSeries(y, 1.0, 1);
+}
+
+// Gamma corrected 8-bit value of level i out of maxLevel.
+constexpr uint8_t neoGfxGammaValue(uint16_t i, uint16_t maxLevel, uint16_t gamma) {
+  return i == 0 ? 0 :
+         (uint8_t)(neoGfxExp(neoGfxLn((double)i / maxLevel) * gamma / 100.0) * 255.0 + 0.5);
+}
+
+template<uint16_t... I>
+struct NeoGfxIndices {
+};
+
+template<uint16_t N, uint16_t... I>
+struct NeoGfxMakeIndices : NeoGfxMakeIndices<N - 1, N - 1, I...> {
+};
+
+template<uint16_t... I>
+struct NeoGfxMakeIndices<0, I...> {
+  typedef NeoGfxIndices<I...> Type;
+};
+
+// Table with the gamma corrected 8-bit values of all 2^BITS input levels,
+// stored in PROGMEM.
+template<uint16_t GAMMA, uint8_t BITS, typename T_INDICES = typename NeoGfxMakeIndices<(1 << BITS)>::Type>
+struct NeoGfxGammaTable;
+
+template<uint16_t GAMMA, uint8_t BITS, uint16_t... I>
+struct NeoGfxGammaTable<GAMMA, BITS, NeoGfxIndices<I...>> {
+  static constexpr uint8_t values[sizeof...(I)] PROGMEM = { neoGfxGammaValue(I, (1 << BITS) - 1, GAMMA)... };
+};
+
+template<uint16_t GAMMA, uint8_t BITS, uint16_t... I>
+constexpr uint8_t NeoGfxGammaTable<GAMMA, BITS, NeoGfxIndices<I...>>::values[sizeof...(I)];
+
+// Gamma per channel, e.g. NeoGfxGamma<260> for 2.6 on all channels or
+// NeoGfxGamma<280, 250, 260> for leds with different color bins.
+// NeoGfxGamma<100> disables the gamma correction.
+template<uint16_t GAMMA_R, uint16_t GAMMA_G = GAMMA_R, uint16_t GAMMA_B = GAMMA_R, uint16_t GAMMA_W = GAMMA_R>
+class NeoGfxGamma {
+
+ public:
+    // 5/6 bit levels of a 16-bit (565) color
+    static uint8_t red5(uint8_t level) {
+      return read<GAMMA_R, 5>(level);
+    }
+
+    static uint8_t green6(uint8_t level) {
+      return read<GAMMA_G, 6>(level);
+    }
+
+    static uint8_t blue5(uint8_t level) {
+      return read<GAMMA_B, 5>(level);
+    }
+
+    // 8-bit levels of full colors
+    static uint8_t red8(uint8_t level) {
+      return read<GAMMA_R, 8>(level);
+    }
+
+    static uint8_t green8(uint8_t level) {
+      return read<GAMMA_G, 8>(level);
+    }
+
+    static uint8_t blue8(uint8_t level) {
+      return read<GAMMA_B, 8>(level);
+    }
+
+    static uint8_t white8(uint8_t level) {
+      return read<GAMMA_W, 8>(level);
+    }
+
+ private:
+    template<uint16_t GAMMA, uint8_t BITS>
+    static uint8_t read(uint8_t level) {
+      const uint8_t* table = NeoGfxGammaTable<GAMMA, BITS>::values;
+      return pgm_read_byte(&table[level]);
+    }
+};
+
+// The original 5/6 bit tables. They don't follow a plain power curve, so
+// they are kept as they are to not change the colors of existing sketches.
+// extras/gamma.c prints tables of a plain curve for other bit depths.
 static const uint8_t PROGMEM
   gamma5[] = {
     0x00,0x01,0x02,0x03,0x05,0x07,0x09,0x0b,
@@ -27,4 +141,22 @@ static const uint8_t PROGMEM
     0x91,0x97,0x9d,0xa4,0xab,0xb2,0xb9,0xc0,
     0xc7,0xcf,0xd6,0xde,0xe6,0xee,0xf7,0xff };
 
+// Default gamma: the original tables for 16-bit colors and gamma 2.6 for
+// full colors.
+class NeoGfxDefaultGamma : public NeoGfxGamma<260> {
+
+ public:
+    static uint8_t red5(uint8_t level) {
+      return pgm_read_byte(&gamma5[level]);
+    }
+
+    static uint8_t green6(uint8_t level) {
+      return pgm_read_byte(&gamma6[level]);
+    }
+
+    static uint8_t blue5(uint8_t level) {
+      return pgm_read_byte(&gamma5[level]);
+    }
+};
+
 #endif // _GAMMA_H_
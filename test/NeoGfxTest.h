@@ -0,0 +1,61 @@
+// Helpers shared by the host tests: checks which report the failing line
+// and let the test continue, and access to the frames sent by Show().
+
+#ifndef _NEOGFX_TEST_H_
+#define _NEOGFX_TEST_H_
+
+#include <stdio.h>
+#include <NeoPixelBus.h>
+
+inline int& neoGfxTestFailures() {
+  static int failures = 0;
+  return failures;
+}
+
+#define NEOGFX_CHECK(cond) \
+  do { \
+    if(!(cond)) { \
+      printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+      neoGfxTestFailures()++; \
+    } \
+  } while(0)
+
+#define NEOGFX_CHECK_EQUAL(actual, expected) \
+  do { \
+    long long a_ = (long long)(actual), e_ = (long long)(expected); \
+    if(a_ != e_) { \
+      printf("%s:%d: %s is %lld, expected %lld\n", __FILE__, __LINE__, #actual, a_, e_); \
+      neoGfxTestFailures()++; \
+    } \
+  } while(0)
+
+// Exit code of the test.
+inline int neoGfxTestResult(const char* name) {
+  if(neoGfxTestFailures()) {
+    printf("%s: %d checks failed\n", name, neoGfxTestFailures());
+    return 1;
+  }
+  printf("%s: passed\n", name);
+  return 0;
+}
+
+// The bytes of the pixel index in the last frame sent on pin, NULL if no
+// frame was sent.
+inline const uint8_t* neoGfxWirePixel(uint16_t index, size_t pixelSize, uint8_t pin = 0) {
+  const NeoMockMethod::Frame* frame = NeoMockMethod::lastFrame(pin);
+  if(!frame || (index + 1) * pixelSize > frame->data.size()) return NULL;
+  return &frame->data[index * pixelSize];
+}
+
+// Whether the pixel index of the last frame sent on pin has the bytes of
+// color in the order of the feature.
+template<typename T_COLOR_FEATURE>
+bool neoGfxWireIs(uint16_t index, typename T_COLOR_FEATURE::ColorObject color, uint8_t pin = 0) {
+  uint8_t expected[T_COLOR_FEATURE::PixelSize];
+  T_COLOR_FEATURE::applyPixelColor(expected, 0, color);
+
+  const uint8_t* pixel = neoGfxWirePixel(index, T_COLOR_FEATURE::PixelSize, pin);
+  return pixel && memcmp(pixel, expected, sizeof(expected)) == 0;
+}
+
+#endif // _NEOGFX_TEST_H_
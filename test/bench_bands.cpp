@@ -0,0 +1,71 @@
+// Band scaling: frames per second of a plasma rendered with renderBands
+// for 1 to NEOGFX_MAX_BANDS bands on a 240x240 matrix, and the raw
+// overhead of neoGfxParallelFor with empty jobs. Prints CSV:
+//
+//   bands,frames,us,frames_per_second,speedup
+//
+// --quick renders one frame per band count (for ctest).
+
+#include <math.h>
+#include <stdio.h>
+#include <NeoPixelBusGfx.h>
+
+static const int W = 240;
+static const int H = 240;
+
+NeoGfxIndex serpentine(uint16_t x, uint16_t y) {
+  return y * W + (y & 1 ? W - 1 - x : x);
+}
+
+typedef NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> Matrix;
+
+static float t = 0;
+
+static void plasma(Adafruit_GFX& gfx, int16_t y0, int16_t h) {
+  for(int16_t y = y0; y < y0 + h; y++) {
+    for(int16_t x = 0; x < gfx.width(); x++) {
+      float v = sinf(x * 0.3f + t) + sinf(y * 0.2f - t) + sinf((x + y) * 0.15f + t) + sinf(sqrtf(x * x + y * y) * 0.25f);
+      uint8_t c = (v + 4) * 31;
+      gfx.drawPixel(x, y, ((c & 0xF8) << 8) | (((255 - c) & 0xFC) << 3) | (c >> 4));
+    }
+  }
+}
+
+static void nothing(void*, uint8_t) {
+}
+
+int main(int argc, char** argv) {
+  bool quick = argc > 1 && strcmp(argv[1], "--quick") == 0;
+  uint32_t frames = quick ? 1 : 50;
+
+  Matrix* matrix = new Matrix(W, H, 0);
+  matrix->setRemapFunction(&serpentine);
+
+  printf("bands,frames,us,frames_per_second,speedup\n");
+  double single = 0;
+  for(uint8_t bands = 1; bands <= NEOGFX_MAX_BANDS; bands++) {
+    unsigned long start = micros();
+    for(uint32_t i = 0; i < frames; i++) {
+      matrix->renderBands(&plasma, bands);
+      t += 0.05f;
+    }
+    unsigned long us = micros() - start;
+    if(us == 0) us = 1;
+
+    double perSecond = frames * 1000000.0 / us;
+    if(bands == 1) single = perSecond;
+    printf("%u,%u,%lu,%.1f,%.2f\n", bands, frames, us, perSecond, perSecond / single);
+  }
+
+  // the cost of spreading the bands over the cores
+  uint32_t calls = quick ? 1 : 2000;
+  unsigned long start = micros();
+  for(uint32_t i = 0; i < calls; i++) {
+    neoGfxParallelFor(NEOGFX_MAX_BANDS, &nothing, NULL);
+  }
+  unsigned long us = micros() - start;
+  printf("# neoGfxParallelFor(%u) without work: %.1f us per call\n", NEOGFX_MAX_BANDS, (double) us / calls);
+
+  delete matrix;
+  return 0;
+}
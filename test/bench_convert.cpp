@@ -0,0 +1,85 @@
+// Bulk conversion of 565 colors: the kernel compiled in (SSSE3, NEON or
+// SWAR, see NeoGfxConvert.h) against converting pixel by pixel, for 3 and
+// 4 bytes per pixel. Fails if the kernel gives other bytes. Prints CSV:
+//
+//   kernel,bytes_per_pixel,pixels,us,megapixels_per_second,speedup
+//
+// --quick converts one frame (for ctest).
+
+#include <stdio.h>
+#include <NeoPixelBusGfx.h>
+
+static const uint16_t PIXELS = 240 * 240;
+
+#if defined(NEOGFX_SSSE3_CONVERT)
+static const char* kernel = "ssse3";
+#elif defined(NEOGFX_NEON_CONVERT)
+static const char* kernel = "neon";
+#elif defined(NEOGFX_SWAR_CONVERT)
+static const char* kernel = "swar";
+#else
+static const char* kernel = "scalar";
+#endif
+
+static uint16_t colors[PIXELS];
+static uint8_t expected[PIXELS * 4];
+static uint8_t converted[PIXELS * 4];
+
+// The pixel by pixel path of neoGfxConvert565.
+static void convertScalar(const NeoGfxWireFormat& f, const uint16_t* in, uint8_t* out, uint16_t count) {
+  const uint32_t fill  = f.fill[0] | (f.fill[1] << 8) | ((uint32_t)f.fill[2] << 16) | ((uint32_t)f.fill[3] << 24);
+  for(; count > 0; count--, in++) {
+    uint32_t pixel = neoGfxWirePixel(f.red, f.green, f.blue, fill, f.r * 8, f.g * 8, f.b * 8, *in);
+    for(uint8_t i = 0; i < f.size; i++, pixel >>= 8) {
+      *out++ = pixel;
+    }
+  }
+}
+
+// Converts the frame in chunks as NeoGfx does, returns the microseconds.
+template<typename T_CONVERT>
+static unsigned long run(const NeoGfxWireFormat& f, uint8_t* out, uint32_t frames, T_CONVERT convert) {
+  unsigned long start = micros();
+  for(uint32_t i = 0; i < frames; i++) {
+    for(uint16_t p = 0; p < PIXELS; p += NEOGFX_CONVERT_CHUNK) {
+      convert(f, &colors[p], &out[p * f.size], NEOGFX_CONVERT_CHUNK);
+    }
+  }
+  unsigned long us = micros() - start;
+  return us ? us : 1;
+}
+
+template<typename T_COLOR_FEATURE>
+static bool bench(uint32_t frames) {
+  NeoGfxWireFormat f;
+  if(!neoGfxProbeWireFormat<T_COLOR_FEATURE>(f)) return false;
+  for(uint8_t i = 0; i < 32; i++) f.red[i] = f.blue[i] = (i << 3) | (i >> 2);
+  for(uint8_t i = 0; i < 64; i++) f.green[i] = (i << 2) | (i >> 4);
+
+  unsigned long scalarUs = run(f, expected,  frames, &convertScalar);
+  unsigned long kernelUs = run(f, converted, frames, &neoGfxConvert565);
+
+  double pixels = (double) frames * PIXELS;
+  printf("scalar,%u,%.0f,%lu,%.1f,1.00\n", f.size, pixels, scalarUs, pixels / scalarUs);
+  printf("%s,%u,%.0f,%lu,%.1f,%.2f\n", kernel, f.size, pixels, kernelUs, pixels / kernelUs, (double) scalarUs / kernelUs);
+
+  return memcmp(expected, converted, PIXELS * f.size) == 0;
+}
+
+int main(int argc, char** argv) {
+  bool quick = argc > 1 && strcmp(argv[1], "--quick") == 0;
+  uint32_t frames = quick ? 1 : 200;
+
+  for(uint32_t i = 0; i < PIXELS; i++) {
+    colors[i] = i * 40503u;
+  }
+
+  printf("kernel,bytes_per_pixel,pixels,us,megapixels_per_second,speedup\n");
+  bool same = bench<NeoGrbFeature>(frames);
+  same = bench<NeoGrbwFeature>(frames) && same;
+  if(!same) {
+    printf("# %s gives other bytes than the scalar path\n", kernel);
+    return 1;
+  }
+  return 0;
+}
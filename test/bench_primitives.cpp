@@ -0,0 +1,51 @@
+// Primitives per second on a 32x32 serpentine matrix, drawn into the mock
+// bus, as the baseline for performance changes. --quick runs a few
+// iterations only (for ctest).
+
+#include <stdio.h>
+#include <NeoPixelBusGfx.h>
+
+static const int W = 32;
+static const int H = 32;
+
+NeoGfxIndex serpentine(uint16_t x, uint16_t y) {
+  return y * W + (y & 1 ? W - 1 - x : x);
+}
+
+typedef NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> Matrix;
+
+static uint16_t bitmap[16 * 16];
+
+template<typename T_DRAW>
+static void run(const char* name, Matrix& matrix, uint32_t iterations, T_DRAW draw) {
+  unsigned long start = micros();
+  for(uint32_t i = 0; i < iterations; i++) {
+    draw(matrix, i);
+  }
+  unsigned long elapsed = micros() - start;
+  if(elapsed == 0) elapsed = 1;
+
+  printf("%-16s %12.0f per second\n", name, iterations * 1000000.0 / elapsed);
+}
+
+int main(int argc, char** argv) {
+  bool quick = argc > 1 && strcmp(argv[1], "--quick") == 0;
+  uint32_t n = quick ? 10 : 20000;
+
+  for(uint16_t i = 0; i < 16 * 16; i++) {
+    bitmap[i] = i * 257;
+  }
+
+  Matrix matrix(W, H, 0);
+  matrix.setRemapFunction(&serpentine);
+
+  run("drawPixel", matrix, n * 50, [](Matrix& m, uint32_t i) { m.drawPixel(i % W, (i / W) % H, i); });
+  run("fillScreen", matrix, n, [](Matrix& m, uint32_t i) { m.fillScreen(i); });
+  run("drawLine", matrix, n * 5, [](Matrix& m, uint32_t i) { m.drawLine(0, i % H, W - 1, H - 1 - i % H, i); });
+  run("fillRect", matrix, n * 5, [](Matrix& m, uint32_t i) { m.fillRect(i % 8, i % 8, 16, 16, i); });
+  run("fillCircle", matrix, n * 2, [](Matrix& m, uint32_t i) { m.fillCircle(W / 2, H / 2, 10, i); });
+  run("print", matrix, n * 2, [](Matrix& m, uint32_t i) { m.setCursor(0, 0); m.setTextColor(i, 0); m.print("Hi!"); });
+  run("drawRGBBitmap", matrix, n, [](Matrix& m, uint32_t i) { m.drawRGBBitmap(i % 16, 0, bitmap, 16, 16); });
+  run("Show", matrix, n, [](Matrix& m, uint32_t i) { m.drawPixel(0, 0, i); m.Show(); NeoMockMethod::clearFrames(); });
+  return 0;
+}
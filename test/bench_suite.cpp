@@ -0,0 +1,150 @@
+// The per primitive benchmark of examples/PrimitiveBenchmark on the host:
+// every primitive for all rotations, with and without a remap function,
+// for NeoGrbFeature and NeoGrbwFeature on both buses and the sizes 8x32,
+// 24x24 and 128x64. Prints CSV (or JSON with --json) to stdout, so runs
+// can be compared between versions:
+//
+//   bus,feature,width,height,rotation,remap,primitive,calls,us,per_second
+//
+// --quick runs every primitive once (for ctest).
+
+#include <stdio.h>
+#include <NeoPixelBusGfx.h>
+#include <NeoPixelBrightnessBusGfx.h>
+
+static unsigned long minTimeUs = 200000UL;
+static bool json = false;
+static bool firstRecord = true;
+
+static uint16_t remapWidth, remapHeight;
+
+// serpentine rows
+NeoGfxIndex remap(uint16_t x, uint16_t y) {
+  return y * remapWidth + (y & 1 ? remapWidth - 1 - x : x);
+}
+
+// 8x8 bitmap, the colors don't matter
+static const uint16_t bitmap[64] = {
+  0xF800, 0x07E0, 0x001F, 0xFFFF, 0xF800, 0x07E0, 0x001F, 0xFFFF,
+  0x07E0, 0x001F, 0xFFFF, 0xF800, 0x07E0, 0x001F, 0xFFFF, 0xF800,
+  0x001F, 0xFFFF, 0xF800, 0x07E0, 0x001F, 0xFFFF, 0xF800, 0x07E0,
+  0xFFFF, 0xF800, 0x07E0, 0x001F, 0xFFFF, 0xF800, 0x07E0, 0x001F,
+  0xF800, 0x07E0, 0x001F, 0xFFFF, 0xF800, 0x07E0, 0x001F, 0xFFFF,
+  0x07E0, 0x001F, 0xFFFF, 0xF800, 0x07E0, 0x001F, 0xFFFF, 0xF800,
+  0x001F, 0xFFFF, 0xF800, 0x07E0, 0x001F, 0xFFFF, 0xF800, 0x07E0,
+  0xFFFF, 0xF800, 0x07E0, 0x001F, 0xFFFF, 0xF800, 0x07E0, 0x001F };
+
+enum Primitive {
+  DRAW_PIXEL, FILL_SCREEN, DRAW_LINE, FILL_RECT, FILL_CIRCLE, PRINT, DRAW_RGB_BITMAP, PRIMITIVE_COUNT
+};
+
+static const char* primitiveNames[PRIMITIVE_COUNT] = {
+  "drawPixel", "fillScreen", "drawLine", "fillRect", "fillCircle", "print", "drawRGBBitmap"
+};
+
+static void drawPrimitive(Adafruit_GFX& gfx, uint8_t primitive, uint32_t n) {
+  int16_t w = gfx.width();
+  int16_t h = gfx.height();
+  uint16_t color = n * 0x1111;
+
+  switch(primitive) {
+  case DRAW_PIXEL:
+    gfx.drawPixel(n % w, (n / w) % h, color);
+    break;
+  case FILL_SCREEN:
+    gfx.fillScreen(color);
+    break;
+  case DRAW_LINE:
+    gfx.drawLine(0, n % h, w - 1, h - 1 - n % h, color);
+    break;
+  case FILL_RECT:
+    gfx.fillRect(n % 4, n % 3, w / 2, h / 2, color);
+    break;
+  case FILL_CIRCLE:
+    gfx.fillCircle(w / 2, h / 2, (w < h ? w : h) / 2, color);
+    break;
+  case PRINT:
+    gfx.setCursor(0, 0);
+    gfx.setTextColor(color, 0);
+    gfx.print("Hello");
+    break;
+  case DRAW_RGB_BITMAP:
+    gfx.drawRGBBitmap(n % w - 4, n % h - 4, bitmap, 8, 8);
+    break;
+  }
+}
+
+static void report(const char* bus, const char* feature, uint16_t w, uint16_t h, uint8_t rotation, bool withRemap, uint8_t primitive, uint32_t calls, unsigned long us) {
+  double perSecond = calls * 1000000.0 / us;
+
+  if(json) {
+    printf("%s\n  {\"bus\": \"%s\", \"feature\": \"%s\", \"width\": %u, \"height\": %u, \"rotation\": %u, \"remap\": %d, "
+           "\"primitive\": \"%s\", \"calls\": %u, \"us\": %lu, \"per_second\": %.1f}",
+           firstRecord ? "" : ",", bus, feature, w, h, rotation, withRemap ? 1 : 0, primitiveNames[primitive], calls, us, perSecond);
+  } else {
+    printf("%s,%s,%u,%u,%u,%d,%s,%u,%lu,%.1f\n", bus, feature, w, h, rotation, withRemap ? 1 : 0, primitiveNames[primitive], calls, us, perSecond);
+  }
+  firstRecord = false;
+}
+
+template<typename T_GFX>
+static void benchmark(const char* bus, const char* feature, uint16_t w, uint16_t h) {
+  T_GFX* matrix = new T_GFX(w, h, 0);
+  matrix->Begin();
+  matrix->setTextWrap(false);
+
+  remapWidth  = w;
+  remapHeight = h;
+
+  for(uint8_t withRemap=0; withRemap<2; withRemap++) {
+    matrix->setRemapFunction(withRemap ? &remap : NULL);
+
+    for(uint8_t rotation=0; rotation<4; rotation++) {
+      matrix->setRotation(rotation);
+
+      for(uint8_t primitive=0; primitive<PRIMITIVE_COUNT; primitive++) {
+        uint32_t calls = 0;
+        unsigned long start = micros();
+        unsigned long us;
+
+        do {
+          for(uint8_t i=0; i<16; i++) {
+            drawPrimitive(*matrix, primitive, calls++);
+          }
+          us = micros() - start;
+        } while(us < minTimeUs);
+
+        report(bus, feature, w, h, rotation, withRemap, primitive, calls, us ? us : 1);
+      }
+    }
+  }
+
+  delete matrix;
+}
+
+template<typename T_FEATURE>
+static void benchmarkSizes(const char* feature) {
+  benchmark<NeoPixelBusGfx<T_FEATURE, Neo800KbpsMethod>>("NeoPixelBus", feature, 8, 32);
+  benchmark<NeoPixelBusGfx<T_FEATURE, Neo800KbpsMethod>>("NeoPixelBus", feature, 24, 24);
+  benchmark<NeoPixelBusGfx<T_FEATURE, Neo800KbpsMethod>>("NeoPixelBus", feature, 128, 64);
+  benchmark<NeoPixelBrightnessBusGfx<T_FEATURE, Neo800KbpsMethod>>("NeoPixelBrightnessBus", feature, 8, 32);
+  benchmark<NeoPixelBrightnessBusGfx<T_FEATURE, Neo800KbpsMethod>>("NeoPixelBrightnessBus", feature, 24, 24);
+  benchmark<NeoPixelBrightnessBusGfx<T_FEATURE, Neo800KbpsMethod>>("NeoPixelBrightnessBus", feature, 128, 64);
+}
+
+int main(int argc, char** argv) {
+  for(int i=1; i<argc; i++) {
+    if(strcmp(argv[i], "--quick") == 0) minTimeUs = 0;
+    if(strcmp(argv[i], "--json") == 0) json = true;
+  }
+
+  if(json) {
+    printf("[");
+  } else {
+    printf("bus,feature,width,height,rotation,remap,primitive,calls,us,per_second\n");
+  }
+  benchmarkSizes<NeoGrbFeature>("NeoGrbFeature");
+  benchmarkSizes<NeoGrbwFeature>("NeoGrbwFeature");
+  if(json) printf("\n]\n");
+  return 0;
+}
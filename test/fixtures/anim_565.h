@@ -0,0 +1,42 @@
+// Generated by tools/neogfx_anim.py from anim_565_frames.h
+// 2 frames of 20x14 pixels, 592 bytes
+
+const uint8_t anim565[] PROGMEM = {
+  0x4E, 0x41, 0x01, 0x14, 0x00, 0x0E, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x19, 0x00, 0x70, 0x01,
+  0x7F, 0x11, 0x11, 0x63, 0x11, 0x11, 0xFF, 0x00, 0x20, 0x25, 0x20, 0x4A, 0x20, 0x6F, 0x20, 0x94,
+  0x20, 0xB9, 0x20, 0xDE, 0x20, 0x03, 0x21, 0x28, 0x21, 0x4D, 0x21, 0x72, 0x21, 0x97, 0x21, 0xBC,
+  0x21, 0xE1, 0x21, 0x06, 0x22, 0x2B, 0x22, 0x50, 0x22, 0x75, 0x22, 0x9A, 0x22, 0xBF, 0x22, 0xE4,
+  0x22, 0x09, 0x23, 0x2E, 0x23, 0x53, 0x23, 0x78, 0x23, 0x9D, 0x23, 0xC2, 0x23, 0xE7, 0x23, 0x0C,
+  0x24, 0x31, 0x24, 0x56, 0x24, 0x7B, 0x24, 0xA0, 0x24, 0xC5, 0x24, 0xEA, 0x24, 0x0F, 0x25, 0x34,
+  0x25, 0x59, 0x25, 0x7E, 0x25, 0xA3, 0x25, 0xC8, 0x25, 0xED, 0x25, 0x12, 0x26, 0x37, 0x26, 0x5C,
+  0x26, 0x81, 0x26, 0xA6, 0x26, 0xCB, 0x26, 0xF0, 0x26, 0x15, 0x27, 0x3A, 0x27, 0x5F, 0x27, 0x84,
+  0x27, 0xA9, 0x27, 0xCE, 0x27, 0xF3, 0x27, 0x18, 0x28, 0x3D, 0x28, 0x62, 0x28, 0x87, 0x28, 0xAC,
+  0x28, 0xD1, 0x28, 0xF6, 0x28, 0x1B, 0x29, 0x40, 0x29, 0x65, 0x29, 0x8A, 0x29, 0xAF, 0x29, 0xD4,
+  0x29, 0xF9, 0x29, 0x1E, 0x2A, 0x43, 0x2A, 0x68, 0x2A, 0x8D, 0x2A, 0xB2, 0x2A, 0xD7, 0x2A, 0xFC,
+  0x2A, 0x21, 0x2B, 0x46, 0x2B, 0x6B, 0x2B, 0x90, 0x2B, 0xB5, 0x2B, 0xDA, 0x2B, 0xFF, 0x2B, 0x24,
+  0x2C, 0x49, 0x2C, 0x6E, 0x2C, 0x93, 0x2C, 0xB8, 0x2C, 0xDD, 0x2C, 0x02, 0x2D, 0x27, 0x2D, 0x4C,
+  0x2D, 0x71, 0x2D, 0x96, 0x2D, 0xBB, 0x2D, 0xE0, 0x2D, 0x05, 0x2E, 0x2A, 0x2E, 0x4F, 0x2E, 0x74,
+  0x2E, 0x99, 0x2E, 0xBE, 0x2E, 0xE3, 0x2E, 0x08, 0x2F, 0x2D, 0x2F, 0x52, 0x2F, 0x77, 0x2F, 0x9C,
+  0x2F, 0xC1, 0x2F, 0xE6, 0x2F, 0x0B, 0x30, 0x30, 0x30, 0x55, 0x30, 0x7A, 0x30, 0x9F, 0x30, 0xC4,
+  0x30, 0xE9, 0x30, 0x0E, 0x31, 0x33, 0x31, 0x58, 0x31, 0x7D, 0x31, 0xA2, 0x31, 0xC7, 0x31, 0xEC,
+  0x31, 0x11, 0x32, 0x36, 0x32, 0x5B, 0x32, 0xB3, 0x80, 0x32, 0xA5, 0x32, 0xCA, 0x32, 0xEF, 0x32,
+  0x14, 0x33, 0x39, 0x33, 0x5E, 0x33, 0x83, 0x33, 0xA8, 0x33, 0xCD, 0x33, 0xF2, 0x33, 0x17, 0x34,
+  0x3C, 0x34, 0x61, 0x34, 0x86, 0x34, 0xAB, 0x34, 0xD0, 0x34, 0xF5, 0x34, 0x1A, 0x35, 0x3F, 0x35,
+  0x64, 0x35, 0x89, 0x35, 0xAE, 0x35, 0xD3, 0x35, 0xF8, 0x35, 0x1D, 0x36, 0x42, 0x36, 0x67, 0x36,
+  0x8C, 0x36, 0xB1, 0x36, 0xD6, 0x36, 0xFB, 0x36, 0x20, 0x37, 0x45, 0x37, 0x6A, 0x37, 0x8F, 0x37,
+  0xB4, 0x37, 0xD9, 0x37, 0xFE, 0x37, 0x23, 0x38, 0x48, 0x38, 0x6D, 0x38, 0x92, 0x38, 0xB7, 0x38,
+  0xDC, 0x38, 0x01, 0x39, 0x26, 0x39, 0x4B, 0x39, 0x70, 0x39, 0x95, 0x39, 0xBA, 0x39, 0xDF, 0x39,
+  0x00, 0x19, 0x00, 0xCB, 0x00, 0x3F, 0x23, 0xE3, 0xB4, 0xA4, 0xE9, 0xA4, 0x1E, 0xA5, 0x53, 0xA5,
+  0x88, 0xA5, 0xBD, 0xA5, 0xF2, 0xA5, 0x27, 0xA6, 0x5C, 0xA6, 0x91, 0xA6, 0xC6, 0xA6, 0xFB, 0xA6,
+  0x30, 0xA7, 0x65, 0xA7, 0x9A, 0xA7, 0xCF, 0xA7, 0x04, 0xA8, 0x39, 0xA8, 0x6E, 0xA8, 0xA3, 0xA8,
+  0xD8, 0xA8, 0x0D, 0xA9, 0x42, 0xA9, 0x77, 0xA9, 0xAC, 0xA9, 0xE1, 0xA9, 0x16, 0xAA, 0x4B, 0xAA,
+  0x80, 0xAA, 0xB5, 0xAA, 0xEA, 0xAA, 0x1F, 0xAB, 0x54, 0xAB, 0x89, 0xAB, 0xBE, 0xAB, 0xF3, 0xAB,
+  0x28, 0xAC, 0x5D, 0xAC, 0x92, 0xAC, 0xC7, 0xAC, 0xFC, 0xAC, 0x31, 0xAD, 0x66, 0xAD, 0x9B, 0xAD,
+  0xD0, 0xAD, 0x05, 0xAE, 0x3A, 0xAE, 0x6F, 0xAE, 0xA4, 0xAE, 0xD9, 0xAE, 0x0E, 0xAF, 0x43, 0xAF,
+  0x78, 0xAF, 0xAD, 0xAF, 0xE2, 0xAF, 0x17, 0xB0, 0x4C, 0xB0, 0x81, 0xB0, 0xB6, 0xB0, 0xEB, 0xB0,
+  0x20, 0xB1, 0x55, 0xB1, 0x8A, 0xB1, 0xBF, 0xB1, 0xF4, 0xB1, 0x29, 0xB2, 0x5E, 0xB2, 0x93, 0xB2,
+  0xC8, 0xB2, 0xFD, 0xB2, 0x32, 0xB3, 0x67, 0xB3, 0x9C, 0xB3, 0xD1, 0xB3, 0x06, 0xB4, 0x3B, 0xB4,
+  0x70, 0xB4, 0xA5, 0xB4, 0xDA, 0xB4, 0x0F, 0xB5, 0x44, 0xB5, 0x79, 0xB5, 0xAE, 0xB5, 0xE3, 0xB5,
+  0x18, 0xB6, 0x4D, 0xB6, 0x82, 0xB6, 0xB7, 0xB6, 0xEC, 0xB6, 0x21, 0xB7, 0x56, 0xB7, 0x8B, 0xB7,
+  0xC0, 0xB7, 0xF5, 0xB7, 0x2A, 0xB8, 0x5F, 0xB8, 0x94, 0xB8, 0xC9, 0xB8, 0xFE, 0xB8, 0x33, 0xB9,
+};
@@ -0,0 +1,36 @@
+// Frames of test_animation (20 x 14, more than 256 colors), encoded with
+//   tools/neogfx_anim.py -W 20 -H 14 -d 25 -n anim565 anim_565_frames.h > anim_565.h
+
+const uint16_t anim565Frame0[] = {
+  0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111,
+  0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111,
+  0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111,
+  0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111,
+  0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111,
+  0x2000, 0x2025, 0x204A, 0x206F, 0x2094, 0x20B9, 0x20DE, 0x2103, 0x2128, 0x214D, 0x2172, 0x2197, 0x21BC, 0x21E1, 0x2206, 0x222B, 0x2250, 0x2275, 0x229A, 0x22BF,
+  0x22E4, 0x2309, 0x232E, 0x2353, 0x2378, 0x239D, 0x23C2, 0x23E7, 0x240C, 0x2431, 0x2456, 0x247B, 0x24A0, 0x24C5, 0x24EA, 0x250F, 0x2534, 0x2559, 0x257E, 0x25A3,
+  0x25C8, 0x25ED, 0x2612, 0x2637, 0x265C, 0x2681, 0x26A6, 0x26CB, 0x26F0, 0x2715, 0x273A, 0x275F, 0x2784, 0x27A9, 0x27CE, 0x27F3, 0x2818, 0x283D, 0x2862, 0x2887,
+  0x28AC, 0x28D1, 0x28F6, 0x291B, 0x2940, 0x2965, 0x298A, 0x29AF, 0x29D4, 0x29F9, 0x2A1E, 0x2A43, 0x2A68, 0x2A8D, 0x2AB2, 0x2AD7, 0x2AFC, 0x2B21, 0x2B46, 0x2B6B,
+  0x2B90, 0x2BB5, 0x2BDA, 0x2BFF, 0x2C24, 0x2C49, 0x2C6E, 0x2C93, 0x2CB8, 0x2CDD, 0x2D02, 0x2D27, 0x2D4C, 0x2D71, 0x2D96, 0x2DBB, 0x2DE0, 0x2E05, 0x2E2A, 0x2E4F,
+  0x2E74, 0x2E99, 0x2EBE, 0x2EE3, 0x2F08, 0x2F2D, 0x2F52, 0x2F77, 0x2F9C, 0x2FC1, 0x2FE6, 0x300B, 0x3030, 0x3055, 0x307A, 0x309F, 0x30C4, 0x30E9, 0x310E, 0x3133,
+  0x3158, 0x317D, 0x31A2, 0x31C7, 0x31EC, 0x3211, 0x3236, 0x325B, 0x3280, 0x32A5, 0x32CA, 0x32EF, 0x3314, 0x3339, 0x335E, 0x3383, 0x33A8, 0x33CD, 0x33F2, 0x3417,
+  0x343C, 0x3461, 0x3486, 0x34AB, 0x34D0, 0x34F5, 0x351A, 0x353F, 0x3564, 0x3589, 0x35AE, 0x35D3, 0x35F8, 0x361D, 0x3642, 0x3667, 0x368C, 0x36B1, 0x36D6, 0x36FB,
+  0x3720, 0x3745, 0x376A, 0x378F, 0x37B4, 0x37D9, 0x37FE, 0x3823, 0x3848, 0x386D, 0x3892, 0x38B7, 0x38DC, 0x3901, 0x3926, 0x394B, 0x3970, 0x3995, 0x39BA, 0x39DF,
+};
+
+const uint16_t anim565Frame1[] = {
+  0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111,
+  0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111,
+  0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111,
+  0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111,
+  0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111,
+  0xA4B4, 0xA4E9, 0xA51E, 0xA553, 0xA588, 0xA5BD, 0xA5F2, 0xA627, 0xA65C, 0xA691, 0xA6C6, 0xA6FB, 0xA730, 0xA765, 0xA79A, 0xA7CF, 0xA804, 0xA839, 0xA86E, 0xA8A3,
+  0xA8D8, 0xA90D, 0xA942, 0xA977, 0xA9AC, 0xA9E1, 0xAA16, 0xAA4B, 0xAA80, 0xAAB5, 0xAAEA, 0xAB1F, 0xAB54, 0xAB89, 0xABBE, 0xABF3, 0xAC28, 0xAC5D, 0xAC92, 0xACC7,
+  0xACFC, 0xAD31, 0xAD66, 0xAD9B, 0xADD0, 0xAE05, 0xAE3A, 0xAE6F, 0xAEA4, 0xAED9, 0xAF0E, 0xAF43, 0xAF78, 0xAFAD, 0xAFE2, 0xB017, 0xB04C, 0xB081, 0xB0B6, 0xB0EB,
+  0xB120, 0xB155, 0xB18A, 0xB1BF, 0xB1F4, 0xB229, 0xB25E, 0xB293, 0xB2C8, 0xB2FD, 0xB332, 0xB367, 0xB39C, 0xB3D1, 0xB406, 0xB43B, 0xB470, 0xB4A5, 0xB4DA, 0xB50F,
+  0xB544, 0xB579, 0xB5AE, 0xB5E3, 0xB618, 0xB64D, 0xB682, 0xB6B7, 0xB6EC, 0xB721, 0xB756, 0xB78B, 0xB7C0, 0xB7F5, 0xB82A, 0xB85F, 0xB894, 0xB8C9, 0xB8FE, 0xB933,
+  0x2E74, 0x2E99, 0x2EBE, 0x2EE3, 0x2F08, 0x2F2D, 0x2F52, 0x2F77, 0x2F9C, 0x2FC1, 0x2FE6, 0x300B, 0x3030, 0x3055, 0x307A, 0x309F, 0x30C4, 0x30E9, 0x310E, 0x3133,
+  0x3158, 0x317D, 0x31A2, 0x31C7, 0x31EC, 0x3211, 0x3236, 0x325B, 0x3280, 0x32A5, 0x32CA, 0x32EF, 0x3314, 0x3339, 0x335E, 0x3383, 0x33A8, 0x33CD, 0x33F2, 0x3417,
+  0x343C, 0x3461, 0x3486, 0x34AB, 0x34D0, 0x34F5, 0x351A, 0x353F, 0x3564, 0x3589, 0x35AE, 0x35D3, 0x35F8, 0x361D, 0x3642, 0x3667, 0x368C, 0x36B1, 0x36D6, 0x36FB,
+  0x3720, 0x3745, 0x376A, 0x378F, 0x37B4, 0x37D9, 0x37FE, 0x3823, 0x3848, 0x386D, 0x3892, 0x38B7, 0x38DC, 0x3901, 0x3926, 0x394B, 0x3970, 0x3995, 0x39BA, 0x39DF,
+};
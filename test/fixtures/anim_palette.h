@@ -0,0 +1,12 @@
+// Generated by tools/neogfx_anim.py from anim_palette_frames.h
+// 5 frames of 10x4 pixels, 112 bytes
+
+const uint8_t animPalette[] PROGMEM = {
+  0x4E, 0x41, 0x01, 0x0A, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1F, 0x00, 0xE0,
+  0x07, 0x00, 0xF8, 0xE0, 0xFF, 0xFF, 0xFF, 0x01, 0x28, 0x00, 0x15, 0x00, 0x46, 0x00, 0x47, 0x03,
+  0x44, 0x00, 0x89, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x48, 0x00, 0x80,
+  0x05, 0x00, 0x28, 0x00, 0x08, 0x00, 0x80, 0x04, 0x0A, 0x80, 0x01, 0x13, 0x80, 0x05, 0x00, 0x28,
+  0x00, 0x03, 0x00, 0x0F, 0x49, 0x04, 0x01, 0x28, 0x00, 0x1D, 0x00, 0x80, 0x04, 0x43, 0x00, 0x81,
+  0x02, 0x00, 0x44, 0x03, 0x83, 0x01, 0x03, 0x03, 0x00, 0x49, 0x04, 0x83, 0x02, 0x01, 0x02, 0x01,
+  0x42, 0x00, 0x80, 0x05, 0x44, 0x00, 0x80, 0x05, 0x00, 0x28, 0x00, 0x03, 0x00, 0x26, 0x80, 0x00,
+};
@@ -0,0 +1,37 @@
+// Frames of test_animation (10 x 4, with a palette), encoded with
+//   tools/neogfx_anim.py -W 10 -H 4 -d 40 -k 3 -n animPalette anim_palette_frames.h > anim_palette.h
+
+const uint16_t animPaletteFrame0[] = {
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0xF800,
+  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x07E0, 0x001F, 0x07E0, 0x001F, 0x07E0, 0x001F, 0x07E0, 0x001F, 0x07E0, 0x001F,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF,
+};
+
+const uint16_t animPaletteFrame1[] = {
+  0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0xF800,
+  0xF800, 0xF800, 0x001F, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x07E0, 0x001F, 0x07E0, 0x001F, 0x07E0, 0x001F, 0x07E0, 0x001F, 0x07E0, 0x001F,
+  0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF,
+};
+
+const uint16_t animPaletteFrame2[] = {
+  0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0xF800,
+  0xF800, 0xF800, 0x001F, 0xF800, 0xF800, 0x0000, 0xFFE0, 0xFFE0, 0xFFE0, 0xFFE0,
+  0xFFE0, 0xFFE0, 0xFFE0, 0xFFE0, 0xFFE0, 0xFFE0, 0x07E0, 0x001F, 0x07E0, 0x001F,
+  0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF,
+};
+
+const uint16_t animPaletteFrame3[] = {
+  0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x07E0, 0x0000, 0xF800, 0xF800, 0xF800,
+  0xF800, 0xF800, 0x001F, 0xF800, 0xF800, 0x0000, 0xFFE0, 0xFFE0, 0xFFE0, 0xFFE0,
+  0xFFE0, 0xFFE0, 0xFFE0, 0xFFE0, 0xFFE0, 0xFFE0, 0x07E0, 0x001F, 0x07E0, 0x001F,
+  0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF,
+};
+
+const uint16_t animPaletteFrame4[] = {
+  0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x07E0, 0x0000, 0xF800, 0xF800, 0xF800,
+  0xF800, 0xF800, 0x001F, 0xF800, 0xF800, 0x0000, 0xFFE0, 0xFFE0, 0xFFE0, 0xFFE0,
+  0xFFE0, 0xFFE0, 0xFFE0, 0xFFE0, 0xFFE0, 0xFFE0, 0x07E0, 0x001F, 0x07E0, 0x001F,
+  0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+};
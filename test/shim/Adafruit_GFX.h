@@ -0,0 +1,401 @@
+// Subset of Adafruit_GFX for the host build of the tests. The primitives
+// use the same algorithms (and so call the same virtual functions) as the
+// real library. The classic font is replaced by a pattern derived from the
+// character, the tests only compare the output of different paths.
+
+#ifndef _NEOGFX_SHIM_ADAFRUIT_GFX_H_
+#define _NEOGFX_SHIM_ADAFRUIT_GFX_H_
+
+#include "Arduino.h"
+
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+
+  size_t print(const char* s) {
+    size_t n = 0;
+    while(*s) n += write(*s++);
+    return n;
+  }
+};
+
+typedef struct {
+  uint16_t bitmapOffset;
+  uint8_t width, height;
+  uint8_t xAdvance;
+  int8_t xOffset, yOffset;
+} GFXglyph;
+
+typedef struct {
+  uint8_t* bitmap;
+  GFXglyph* glyph;
+  uint16_t first, last;
+  uint8_t yAdvance;
+} GFXfont;
+
+class Adafruit_GFX : public Print {
+ public:
+  Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h), _width(w), _height(h) {}
+
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+  virtual void startWrite() {}
+  virtual void endWrite() {}
+
+  virtual void writePixel(int16_t x, int16_t y, uint16_t color) {
+    drawPixel(x, y, color);
+  }
+
+  virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    fillRect(x, y, w, h, color);
+  }
+
+  virtual void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    drawFastVLine(x, y, h, color);
+  }
+
+  virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    drawFastHLine(x, y, w, color);
+  }
+
+  virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    bool steep = abs(y1 - y0) > abs(x1 - x0);
+    if(steep) { swap(x0, y0); swap(x1, y1); }
+    if(x0 > x1) { swap(x0, x1); swap(y0, y1); }
+
+    int16_t dx = x1 - x0;
+    int16_t dy = abs(y1 - y0);
+    int16_t err = dx / 2;
+    int16_t ystep = y0 < y1 ? 1 : -1;
+
+    for(; x0 <= x1; x0++) {
+      if(steep) {
+        writePixel(y0, x0, color);
+      } else {
+        writePixel(x0, y0, color);
+      }
+      err -= dy;
+      if(err < 0) {
+        y0 += ystep;
+        err += dx;
+      }
+    }
+  }
+
+  virtual void setRotation(uint8_t r) {
+    rotation = r & 3;
+    _width  = rotation & 1 ? HEIGHT : WIDTH;
+    _height = rotation & 1 ? WIDTH  : HEIGHT;
+  }
+
+  virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    startWrite();
+    writeLine(x, y, x, y + h - 1, color);
+    endWrite();
+  }
+
+  virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    startWrite();
+    writeLine(x, y, x + w - 1, y, color);
+    endWrite();
+  }
+
+  virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    startWrite();
+    for(int16_t i = x; i < x + w; i++) {
+      writeFastVLine(i, y, h, color);
+    }
+    endWrite();
+  }
+
+  virtual void fillScreen(uint16_t color) {
+    fillRect(0, 0, _width, _height, color);
+  }
+
+  virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    if(x0 == x1) {
+      if(y0 > y1) swap(y0, y1);
+      drawFastVLine(x0, y0, y1 - y0 + 1, color);
+    } else if(y0 == y1) {
+      if(x0 > x1) swap(x0, x1);
+      drawFastHLine(x0, y0, x1 - x0 + 1, color);
+    } else {
+      startWrite();
+      writeLine(x0, y0, x1, y1, color);
+      endWrite();
+    }
+  }
+
+  virtual void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    startWrite();
+    writeFastHLine(x, y, w, color);
+    writeFastHLine(x, y + h - 1, w, color);
+    writeFastVLine(x, y, h, color);
+    writeFastVLine(x + w - 1, y, h, color);
+    endWrite();
+  }
+
+  void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    int16_t f = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x = 0;
+    int16_t y = r;
+
+    startWrite();
+    writePixel(x0, y0 + r, color);
+    writePixel(x0, y0 - r, color);
+    writePixel(x0 + r, y0, color);
+    writePixel(x0 - r, y0, color);
+
+    while(x < y) {
+      if(f >= 0) {
+        y--;
+        ddF_y += 2;
+        f += ddF_y;
+      }
+      x++;
+      ddF_x += 2;
+      f += ddF_x;
+
+      writePixel(x0 + x, y0 + y, color);
+      writePixel(x0 - x, y0 + y, color);
+      writePixel(x0 + x, y0 - y, color);
+      writePixel(x0 - x, y0 - y, color);
+      writePixel(x0 + y, y0 + x, color);
+      writePixel(x0 - y, y0 + x, color);
+      writePixel(x0 + y, y0 - x, color);
+      writePixel(x0 - y, y0 - x, color);
+    }
+    endWrite();
+  }
+
+  void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    startWrite();
+    writeFastVLine(x0, y0 - r, 2 * r + 1, color);
+    fillCircleHelper(x0, y0, r, 3, 0, color);
+    endWrite();
+  }
+
+  void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta, uint16_t color) {
+    int16_t f = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x = 0;
+    int16_t y = r;
+    int16_t px = x;
+    int16_t py = y;
+
+    delta++;
+
+    while(x < y) {
+      if(f >= 0) {
+        y--;
+        ddF_y += 2;
+        f += ddF_y;
+      }
+      x++;
+      ddF_x += 2;
+      f += ddF_x;
+
+      if(x < (y + 1)) {
+        if(corners & 1) writeFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
+        if(corners & 2) writeFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
+      }
+      if(y != py) {
+        if(corners & 1) writeFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
+        if(corners & 2) writeFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
+        py = y;
+      }
+      px = x;
+    }
+  }
+
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color) {
+    drawBitmap(x, y, (uint8_t*) bitmap, w, h, color);
+  }
+
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+    drawBitmap(x, y, (uint8_t*) bitmap, w, h, color, bg);
+  }
+
+  void drawBitmap(int16_t x, int16_t y, uint8_t* bitmap, int16_t w, int16_t h, uint16_t color) {
+    int16_t byteWidth = (w + 7) / 8;
+    startWrite();
+    for(int16_t j = 0; j < h; j++) {
+      for(int16_t i = 0; i < w; i++) {
+        if(bitmap[j * byteWidth + i / 8] & (0x80 >> (i & 7))) writePixel(x + i, y + j, color);
+      }
+    }
+    endWrite();
+  }
+
+  void drawBitmap(int16_t x, int16_t y, uint8_t* bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+    int16_t byteWidth = (w + 7) / 8;
+    startWrite();
+    for(int16_t j = 0; j < h; j++) {
+      for(int16_t i = 0; i < w; i++) {
+        writePixel(x + i, y + j, bitmap[j * byteWidth + i / 8] & (0x80 >> (i & 7)) ? color : bg);
+      }
+    }
+    endWrite();
+  }
+
+  void drawGrayscaleBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h) {
+    drawGrayscaleBitmap(x, y, (uint8_t*) bitmap, w, h);
+  }
+
+  void drawGrayscaleBitmap(int16_t x, int16_t y, uint8_t* bitmap, int16_t w, int16_t h) {
+    startWrite();
+    for(int16_t j = 0; j < h; j++) {
+      for(int16_t i = 0; i < w; i++) {
+        writePixel(x + i, y + j, bitmap[j * w + i]);
+      }
+    }
+    endWrite();
+  }
+
+  void drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w, int16_t h) {
+    drawRGBBitmap(x, y, (uint16_t*) bitmap, w, h);
+  }
+
+  void drawRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w, int16_t h) {
+    startWrite();
+    for(int16_t j = 0; j < h; j++) {
+      for(int16_t i = 0; i < w; i++) {
+        writePixel(x + i, y + j, bitmap[j * w + i]);
+      }
+    }
+    endWrite();
+  }
+
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size) {
+    drawChar(x, y, c, color, bg, size, size);
+  }
+
+  virtual void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t sizeX, uint8_t sizeY) {
+    startWrite();
+    if(gfxFont) {
+      const GFXglyph* glyph = &gfxFont->glyph[c - gfxFont->first];
+      const uint8_t* bitmap = gfxFont->bitmap + glyph->bitmapOffset;
+      uint8_t bits = 0, bit = 0;
+
+      for(int16_t yy = 0; yy < glyph->height; yy++) {
+        for(int16_t xx = 0; xx < glyph->width; xx++) {
+          if(!(bit++ & 7)) bits = *bitmap++;
+          if(bits & 0x80) {
+            if(sizeX == 1 && sizeY == 1) {
+              writePixel(x + glyph->xOffset + xx, y + glyph->yOffset + yy, color);
+            } else {
+              writeFillRect(x + (glyph->xOffset + xx) * sizeX, y + (glyph->yOffset + yy) * sizeY, sizeX, sizeY, color);
+            }
+          }
+          bits <<= 1;
+        }
+      }
+      endWrite();
+      return;
+    }
+
+    if(!_cp437 && c >= 176) c++;
+    for(int8_t i = 0; i < 5; i++) {
+      uint8_t line = classicColumn(c, i);
+      for(int8_t j = 0; j < 8; j++, line >>= 1) {
+        if(line & 1) {
+          if(sizeX == 1 && sizeY == 1) {
+            writePixel(x + i, y + j, color);
+          } else {
+            writeFillRect(x + i * sizeX, y + j * sizeY, sizeX, sizeY, color);
+          }
+        } else if(bg != color) {
+          if(sizeX == 1 && sizeY == 1) {
+            writePixel(x + i, y + j, bg);
+          } else {
+            writeFillRect(x + i * sizeX, y + j * sizeY, sizeX, sizeY, bg);
+          }
+        }
+      }
+    }
+    if(bg != color) {
+      if(sizeX == 1 && sizeY == 1) {
+        writeFastVLine(x + 5, y, 8, bg);
+      } else {
+        writeFillRect(x + 5 * sizeX, y, sizeX, 8 * sizeY, bg);
+      }
+    }
+    endWrite();
+  }
+
+  virtual size_t write(uint8_t c) {
+    if(!gfxFont) {
+      if(c == '\n') {
+        cursor_x = 0;
+        cursor_y += textsize_y * 8;
+      } else if(c != '\r') {
+        if(wrap && (cursor_x + textsize_x * 6) > _width) {
+          cursor_x = 0;
+          cursor_y += textsize_y * 8;
+        }
+        drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x, textsize_y);
+        cursor_x += textsize_x * 6;
+      }
+      return 1;
+    }
+
+    if(c == '\n') {
+      cursor_x = 0;
+      cursor_y += textsize_y * gfxFont->yAdvance;
+    } else if(c != '\r' && c >= gfxFont->first && c <= gfxFont->last) {
+      const GFXglyph* glyph = &gfxFont->glyph[c - gfxFont->first];
+      if(glyph->width > 0 && glyph->height > 0) {
+        if(wrap && (cursor_x + textsize_x * (glyph->xOffset + glyph->width)) > _width) {
+          cursor_x = 0;
+          cursor_y += textsize_y * gfxFont->yAdvance;
+        }
+        drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x, textsize_y);
+      }
+      cursor_x += glyph->xAdvance * (int16_t) textsize_x;
+    }
+    return 1;
+  }
+
+  void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+  void setTextColor(uint16_t c) { textcolor = textbgcolor = c; }
+  void setTextColor(uint16_t c, uint16_t bg) { textcolor = c; textbgcolor = bg; }
+  void setTextSize(uint8_t s) { setTextSize(s, s); }
+  void setTextSize(uint8_t sx, uint8_t sy) { textsize_x = sx > 0 ? sx : 1; textsize_y = sy > 0 ? sy : 1; }
+  void setTextWrap(bool w) { wrap = w; }
+  void cp437(bool x = true) { _cp437 = x; }
+  void setFont(const GFXfont* f = NULL) { gfxFont = (GFXfont*) f; }
+
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+  uint8_t getRotation() const { return rotation; }
+  int16_t getCursorX() const { return cursor_x; }
+  int16_t getCursorY() const { return cursor_y; }
+
+ protected:
+  static void swap(int16_t& a, int16_t& b) {
+    int16_t t = a;
+    a = b;
+    b = t;
+  }
+
+  // stands in for the column i of the glyph of c in glcdfont.c
+  static uint8_t classicColumn(unsigned char c, int8_t i) {
+    return (uint8_t)((c * 37 + i * 101) ^ (c >> 2)) & 0x7F;
+  }
+
+  int16_t WIDTH, HEIGHT;
+  int16_t _width, _height;
+  int16_t cursor_x = 0, cursor_y = 0;
+  uint16_t textcolor = 0xFFFF, textbgcolor = 0xFFFF;
+  uint8_t textsize_x = 1, textsize_y = 1;
+  uint8_t rotation = 0;
+  bool wrap = true;
+  bool _cp437 = false;
+  GFXfont* gfxFont = NULL;
+};
+
+#endif // _NEOGFX_SHIM_ADAFRUIT_GFX_H_
@@ -0,0 +1,47 @@
+// Minimal Arduino core for the host build of the tests, just what the
+// library and the Adafruit_GFX shim use.
+
+#ifndef _NEOGFX_SHIM_ARDUINO_H_
+#define _NEOGFX_SHIM_ARDUINO_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+// Tests can drive the clock: after neoShimSetMicros() micros() returns the
+// time set instead of the real one.
+inline bool& neoShimFakeClock() {
+  static bool fake = false;
+  return fake;
+}
+
+inline unsigned long& neoShimMicros() {
+  static unsigned long now = 0;
+  return now;
+}
+
+inline void neoShimSetMicros(unsigned long now) {
+  neoShimFakeClock() = true;
+  neoShimMicros() = now;
+}
+
+inline unsigned long micros() {
+  if(neoShimFakeClock()) return neoShimMicros();
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+inline unsigned long millis() {
+  return micros() / 1000;
+}
+
+inline void yield() {}
+inline void delay(unsigned long) {}
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+#define pgm_read_word(addr) (*(const unsigned short *)(addr))
+#define pgm_read_pointer(addr) ((void *)(*(void * const *)(addr)))
+#define memcpy_P(dest, src, num) memcpy((dest), (src), (num))
+
+#endif // _NEOGFX_SHIM_ARDUINO_H_
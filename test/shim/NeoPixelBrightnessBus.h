@@ -0,0 +1,81 @@
+// NeoPixelBrightnessBus for the host build of the tests. Like the real one
+// it scales the channels on SetPixelColor, scales them back on
+// GetPixelColor and rescales all pixels on SetBrightness.
+
+#ifndef _NEOGFX_SHIM_NEOPIXELBRIGHTNESSBUS_H_
+#define _NEOGFX_SHIM_NEOPIXELBRIGHTNESSBUS_H_
+
+#include "NeoPixelBus.h"
+
+template<typename T_COLOR_FEATURE, typename T_METHOD>
+class NeoPixelBrightnessBus : public NeoPixelBus<T_COLOR_FEATURE, T_METHOD> {
+ public:
+  NeoPixelBrightnessBus(uint16_t countPixels, uint8_t pin) :
+    NeoPixelBus<T_COLOR_FEATURE, T_METHOD>(countPixels, pin)
+  {
+  }
+
+  NeoPixelBrightnessBus(uint16_t countPixels, uint8_t pinClock, uint8_t pinData) :
+    NeoPixelBus<T_COLOR_FEATURE, T_METHOD>(countPixels, pinClock, pinData)
+  {
+  }
+
+  NeoPixelBrightnessBus(uint16_t countPixels) :
+    NeoPixelBus<T_COLOR_FEATURE, T_METHOD>(countPixels)
+  {
+  }
+
+  void SetBrightness(uint8_t brightness) {
+    if(brightness == _brightness) return;
+
+    for(uint16_t i = 0; i < this->PixelCount(); i++) {
+      typename T_COLOR_FEATURE::ColorObject color = GetPixelColor(i);
+      NeoPixelBus<T_COLOR_FEATURE, T_METHOD>::SetPixelColor(i, scale(color, brightness));
+    }
+    _brightness = brightness;
+    this->Dirty();
+  }
+
+  uint8_t GetBrightness() const {
+    return _brightness;
+  }
+
+  void SetPixelColor(uint16_t indexPixel, typename T_COLOR_FEATURE::ColorObject color) {
+    NeoPixelBus<T_COLOR_FEATURE, T_METHOD>::SetPixelColor(indexPixel, scale(color, _brightness));
+  }
+
+  typename T_COLOR_FEATURE::ColorObject GetPixelColor(uint16_t indexPixel) const {
+    typename T_COLOR_FEATURE::ColorObject color = NeoPixelBus<T_COLOR_FEATURE, T_METHOD>::GetPixelColor(indexPixel);
+    return recover(color);
+  }
+
+ private:
+  static uint8_t scale(uint8_t value, uint8_t brightness) {
+    return ((uint16_t) value * (brightness + 1)) >> 8;
+  }
+
+  uint8_t recover(uint8_t value) const {
+    uint16_t v = ((uint16_t) value << 8) / (_brightness + 1);
+    return v > 255 ? 255 : v;
+  }
+
+  static RgbColor scale(RgbColor c, uint8_t brightness) {
+    return RgbColor(scale(c.R, brightness), scale(c.G, brightness), scale(c.B, brightness));
+  }
+
+  static RgbwColor scale(RgbwColor c, uint8_t brightness) {
+    return RgbwColor(scale(c.R, brightness), scale(c.G, brightness), scale(c.B, brightness), scale(c.W, brightness));
+  }
+
+  RgbColor recover(RgbColor c) const {
+    return RgbColor(recover(c.R), recover(c.G), recover(c.B));
+  }
+
+  RgbwColor recover(RgbwColor c) const {
+    return RgbwColor(recover(c.R), recover(c.G), recover(c.B), recover(c.W));
+  }
+
+  uint8_t _brightness = 255;
+};
+
+#endif // _NEOGFX_SHIM_NEOPIXELBRIGHTNESSBUS_H_
@@ -0,0 +1,271 @@
+// Subset of NeoPixelBus for the host build of the tests: the colors, a few
+// features with different channel orders and prefixes, and a bus whose
+// method (NeoMockMethod) records every frame sent by Show().
+
+#ifndef _NEOGFX_SHIM_NEOPIXELBUS_H_
+#define _NEOGFX_SHIM_NEOPIXELBUS_H_
+
+#include "Arduino.h"
+#include <vector>
+
+struct HtmlColor {
+  HtmlColor(uint32_t color) : Color(color) {}
+  uint32_t Color;
+};
+
+struct RgbColor {
+  RgbColor() : R(0), G(0), B(0) {}
+  RgbColor(uint8_t r, uint8_t g, uint8_t b) : R(r), G(g), B(b) {}
+  RgbColor(uint8_t brightness) : R(brightness), G(brightness), B(brightness) {}
+  RgbColor(const HtmlColor& color) : R(color.Color >> 16), G(color.Color >> 8), B(color.Color) {}
+
+  bool operator==(const RgbColor& other) const { return R == other.R && G == other.G && B == other.B; }
+  bool operator!=(const RgbColor& other) const { return !(*this == other); }
+
+  uint8_t R, G, B;
+};
+
+struct RgbwColor {
+  RgbwColor() : R(0), G(0), B(0), W(0) {}
+  RgbwColor(uint8_t r, uint8_t g, uint8_t b, uint8_t w = 0) : R(r), G(g), B(b), W(w) {}
+  RgbwColor(uint8_t brightness) : R(0), G(0), B(0), W(brightness) {}
+  RgbwColor(const RgbColor& color) : R(color.R), G(color.G), B(color.B), W(0) {}
+  RgbwColor(const HtmlColor& color) : RgbwColor(RgbColor(color)) {}
+
+  bool operator==(const RgbwColor& other) const { return R == other.R && G == other.G && B == other.B && W == other.W; }
+  bool operator!=(const RgbwColor& other) const { return !(*this == other); }
+
+  uint8_t R, G, B, W;
+};
+
+// Features storing the channels in the order given by the template
+// arguments (0: R, 1: G, 2: B, 3: W).
+template<uint8_t C0, uint8_t C1, uint8_t C2>
+class NeoShim3Feature {
+ public:
+  static const size_t PixelSize = 3;
+  typedef RgbColor ColorObject;
+
+  static void applyPixelColor(uint8_t* pixels, uint16_t index, ColorObject color) {
+    uint8_t* p = pixels + (size_t)index * PixelSize;
+    p[0] = channel(color, C0);
+    p[1] = channel(color, C1);
+    p[2] = channel(color, C2);
+  }
+
+  static ColorObject retrievePixelColor(const uint8_t* pixels, uint16_t index) {
+    const uint8_t* p = pixels + (size_t)index * PixelSize;
+    ColorObject color;
+    channel(color, C0) = p[0];
+    channel(color, C1) = p[1];
+    channel(color, C2) = p[2];
+    return color;
+  }
+
+ private:
+  static uint8_t channel(const ColorObject& c, uint8_t i) { return i == 0 ? c.R : i == 1 ? c.G : c.B; }
+  static uint8_t& channel(ColorObject& c, uint8_t i) { return i == 0 ? c.R : i == 1 ? c.G : c.B; }
+};
+
+template<uint8_t C0, uint8_t C1, uint8_t C2, uint8_t C3>
+class NeoShim4Feature {
+ public:
+  static const size_t PixelSize = 4;
+  typedef RgbwColor ColorObject;
+
+  static void applyPixelColor(uint8_t* pixels, uint16_t index, ColorObject color) {
+    uint8_t* p = pixels + (size_t)index * PixelSize;
+    p[0] = channel(color, C0);
+    p[1] = channel(color, C1);
+    p[2] = channel(color, C2);
+    p[3] = channel(color, C3);
+  }
+
+  static ColorObject retrievePixelColor(const uint8_t* pixels, uint16_t index) {
+    const uint8_t* p = pixels + (size_t)index * PixelSize;
+    ColorObject color;
+    channel(color, C0) = p[0];
+    channel(color, C1) = p[1];
+    channel(color, C2) = p[2];
+    channel(color, C3) = p[3];
+    return color;
+  }
+
+ private:
+  static uint8_t channel(const ColorObject& c, uint8_t i) { return i == 0 ? c.R : i == 1 ? c.G : i == 2 ? c.B : c.W; }
+  static uint8_t& channel(ColorObject& c, uint8_t i) { return i == 0 ? c.R : i == 1 ? c.G : i == 2 ? c.B : c.W; }
+};
+
+typedef NeoShim3Feature<1, 0, 2> NeoGrbFeature;
+typedef NeoShim3Feature<0, 1, 2> NeoRgbFeature;
+typedef NeoShim3Feature<2, 0, 1> NeoBrgFeature;
+typedef NeoShim4Feature<1, 0, 2, 3> NeoGrbwFeature;
+typedef NeoShim4Feature<0, 1, 2, 3> NeoRgbwFeature;
+
+// DotStars start every pixel with a 0xFF prefix (full global brightness).
+class DotStarBgrFeature {
+ public:
+  static const size_t PixelSize = 4;
+  typedef RgbColor ColorObject;
+
+  static void applyPixelColor(uint8_t* pixels, uint16_t index, ColorObject color) {
+    uint8_t* p = pixels + (size_t)index * PixelSize;
+    p[0] = 0xFF;
+    p[1] = color.B;
+    p[2] = color.G;
+    p[3] = color.R;
+  }
+
+  static ColorObject retrievePixelColor(const uint8_t* pixels, uint16_t index) {
+    const uint8_t* p = pixels + (size_t)index * PixelSize;
+    return ColorObject(p[3], p[2], p[1]);
+  }
+};
+
+// The LPD8806 has 7 bits per channel and the high bit set in every byte.
+class Lpd8806GrbFeature {
+ public:
+  static const size_t PixelSize = 3;
+  typedef RgbColor ColorObject;
+
+  static void applyPixelColor(uint8_t* pixels, uint16_t index, ColorObject color) {
+    uint8_t* p = pixels + (size_t)index * PixelSize;
+    p[0] = (color.G >> 1) | 0x80;
+    p[1] = (color.R >> 1) | 0x80;
+    p[2] = (color.B >> 1) | 0x80;
+  }
+
+  static ColorObject retrievePixelColor(const uint8_t* pixels, uint16_t index) {
+    const uint8_t* p = pixels + (size_t)index * PixelSize;
+    return ColorObject((p[1] & 0x7F) << 1, (p[0] & 0x7F) << 1, (p[2] & 0x7F) << 1);
+  }
+};
+
+// Records the bytes of every frame sent, with the pin of the bus, so the
+// tests can check what ends up on the wire.
+class NeoMockMethod {
+ public:
+  struct Frame {
+    uint8_t pin;
+    std::vector<uint8_t> data;
+  };
+
+  NeoMockMethod(uint8_t pin) : pin(pin) {}
+
+  void Update(const uint8_t* pixels, size_t size) {
+    Frame frame;
+    frame.pin  = pin;
+    frame.data.assign(pixels, pixels + size);
+    frames().push_back(frame);
+  }
+
+  static std::vector<Frame>& frames() {
+    static std::vector<Frame> sent;
+    return sent;
+  }
+
+  // The last frame sent on pin, NULL if there was none.
+  static const Frame* lastFrame(uint8_t pin = 0) {
+    for(size_t i = frames().size(); i > 0; i--) {
+      if(frames()[i - 1].pin == pin) return &frames()[i - 1];
+    }
+    return NULL;
+  }
+
+  static void clearFrames() {
+    frames().clear();
+  }
+
+  // Tests can make all buses busy, as if they were still sending.
+  static bool& busy() {
+    static bool sending = false;
+    return sending;
+  }
+
+  bool IsReadyToUpdate() const {
+    return !busy();
+  }
+
+ private:
+  uint8_t pin;
+};
+
+typedef NeoMockMethod Neo800KbpsMethod;
+typedef NeoMockMethod NeoEsp32Rmt0800KbpsMethod;
+typedef NeoMockMethod DotStarMethod;
+
+template<typename T_COLOR_FEATURE, typename T_METHOD>
+class NeoPixelBus {
+ public:
+  NeoPixelBus(uint16_t countPixels, uint8_t pin) :
+    _countPixels(countPixels),
+    _pixels((uint8_t*) calloc(countPixels, T_COLOR_FEATURE::PixelSize)),
+    _method(pin)
+  {
+  }
+
+  NeoPixelBus(uint16_t countPixels, uint8_t pinClock, uint8_t pinData) :
+    NeoPixelBus(countPixels, pinData)
+  {
+    (void) pinClock;
+  }
+
+  NeoPixelBus(uint16_t countPixels) :
+    NeoPixelBus(countPixels, (uint8_t) 0)
+  {
+  }
+
+  ~NeoPixelBus() {
+    free(_pixels);
+  }
+
+  void Begin() {}
+
+  void Show(bool maintainBufferConsistency = true) {
+    (void) maintainBufferConsistency;
+    if(!IsDirty()) return;
+
+    _method.Update(_pixels, PixelsSize());
+    ResetDirty();
+  }
+
+  bool CanShow() const { return _method.IsReadyToUpdate(); }
+  bool IsDirty() const { return _dirty; }
+  void Dirty() { _dirty = true; }
+  void ResetDirty() { _dirty = false; }
+
+  uint8_t* Pixels() { return _pixels; }
+  size_t PixelsSize() const { return (size_t)_countPixels * T_COLOR_FEATURE::PixelSize; }
+  size_t PixelSize() const { return T_COLOR_FEATURE::PixelSize; }
+  uint16_t PixelCount() const { return _countPixels; }
+
+  void SetPixelColor(uint16_t indexPixel, typename T_COLOR_FEATURE::ColorObject color) {
+    if(indexPixel >= _countPixels) return;
+
+    T_COLOR_FEATURE::applyPixelColor(_pixels, indexPixel, color);
+    Dirty();
+  }
+
+  typename T_COLOR_FEATURE::ColorObject GetPixelColor(uint16_t indexPixel) const {
+    if(indexPixel >= _countPixels) return typename T_COLOR_FEATURE::ColorObject(0);
+    return T_COLOR_FEATURE::retrievePixelColor(_pixels, indexPixel);
+  }
+
+  void ClearTo(typename T_COLOR_FEATURE::ColorObject color) {
+    for(uint16_t i = 0; i < _countPixels; i++) {
+      SetPixelColor(i, color);
+    }
+  }
+
+ protected:
+  const uint16_t _countPixels;
+  uint8_t* _pixels;
+  bool _dirty = true;
+  T_METHOD _method;
+
+ private:
+  NeoPixelBus(const NeoPixelBus&);
+  NeoPixelBus& operator=(const NeoPixelBus&);
+};
+
+#endif // _NEOGFX_SHIM_NEOPIXELBUS_H_
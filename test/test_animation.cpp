@@ -0,0 +1,129 @@
+// Animations: the fixtures in fixtures/ were encoded by tools/neogfx_anim.py
+// from the frames next to them. Decoding gives every frame, key frames
+// draw all pixels, delta frames only the changed ones, with and without a
+// palette, and on a matrix the frames match drawing them as bitmaps.
+
+#include <vector>
+#include <NeoPixelBusGfx.h>
+#include <NeoGfxAnimation.h>
+#include "NeoGfxTest.h"
+
+#include "fixtures/anim_palette.h"
+#include "fixtures/anim_palette_frames.h"
+#include "fixtures/anim_565.h"
+#include "fixtures/anim_565_frames.h"
+
+// Takes the place of the matrix: keeps the pixels and which of them were
+// drawn by the last frame.
+struct Recorder {
+    int16_t w, h;
+    std::vector<uint16_t> pixels;
+    std::vector<bool> touched;
+    bool outside;
+
+    Recorder(int16_t width, int16_t height) :
+      w(width), h(height), pixels(width * height, 0), touched(width * height, false), outside(false)
+    {
+    }
+
+    void set(int16_t x, int16_t y, uint16_t color) {
+      if(x < 0 || y < 0 || x >= w || y >= h) {
+        outside = true;
+        return;
+      }
+      pixels[y * w + x] = color;
+      touched[y * w + x] = true;
+    }
+
+    void writeFastHLine(int16_t x, int16_t y, int16_t n, uint16_t color) {
+      for(int16_t i = 0; i < n; i++) set(x + i, y, color);
+    }
+
+    void drawRGBBitmap(int16_t x, int16_t y, const uint16_t* bitmap, int16_t bw, int16_t bh) {
+      for(int16_t j = 0; j < bh; j++) {
+        for(int16_t i = 0; i < bw; i++) set(x + i, y + j, bitmap[j * bw + i]);
+      }
+    }
+};
+
+// Plays the animation twice (it starts over after the last frame) and
+// checks every frame against the frames it was encoded from.
+static void play(const uint8_t* data, const uint16_t* const* frames, uint16_t count, int16_t w, int16_t h, uint16_t delay, uint16_t keyframeInterval) {
+  NeoGfxAnimation<NeoGfxProgmemReader> animation(data);
+  NEOGFX_CHECK(animation.begin());
+  NEOGFX_CHECK_EQUAL(animation.getWidth(), w);
+  NEOGFX_CHECK_EQUAL(animation.getHeight(), h);
+  NEOGFX_CHECK_EQUAL(animation.getFrameCount(), count);
+
+  Recorder gfx(w, h);
+  for(uint16_t n = 0; n < 2 * count; n++) {
+    uint16_t frame = n % count;
+    const uint16_t* expected = frames[frame];
+    const uint16_t* previous = frames[(frame + count - 1) % count];
+    bool key = frame == 0 || (keyframeInterval && frame % keyframeInterval == 0);
+
+    gfx.touched.assign(w * h, false);
+    NEOGFX_CHECK_EQUAL(animation.getFrame(), frame);
+    NEOGFX_CHECK_EQUAL(animation.drawFrame(gfx, 0, 0), delay);
+    NEOGFX_CHECK(!gfx.outside);
+
+    for(int16_t i = 0; i < w * h; i++) {
+      if(gfx.pixels[i] != expected[i]) {
+        printf("frame %u pixel %d: 0x%04X instead of 0x%04X\n", frame, i, gfx.pixels[i], expected[i]);
+        NEOGFX_CHECK(!"wrong pixel");
+      }
+      // key frames draw every pixel, delta frames only the changed ones
+      bool changed = key || expected[i] != previous[i];
+      if(gfx.touched[i] != changed) {
+        printf("frame %u pixel %d: %s\n", frame, i, changed ? "not drawn" : "drawn without change");
+        NEOGFX_CHECK(!"wrong pixels drawn");
+      }
+    }
+  }
+
+  animation.rewind();
+  NEOGFX_CHECK_EQUAL(animation.getFrame(), 0);
+}
+
+static const int W = 10;
+static const int H = 4;
+
+NeoGfxIndex serpentine(uint16_t x, uint16_t y) {
+  return y * W + (y & 1 ? W - 1 - x : x);
+}
+
+int main() {
+  static const uint16_t* const paletteFrames[] = { animPaletteFrame0, animPaletteFrame1, animPaletteFrame2, animPaletteFrame3, animPaletteFrame4 };
+  play(animPalette, paletteFrames, 5, 10, 4, 40, 3);
+
+  static const uint16_t* const frames565[] = { anim565Frame0, anim565Frame1 };
+  play(anim565, frames565, 2, 20, 14, 25, 0);
+
+  // not an animation
+  {
+    static const uint8_t garbage[] = { 'N', 'B', 1, 0 };
+    NeoGfxAnimation<NeoGfxProgmemReader> animation(garbage);
+    NEOGFX_CHECK(!animation.begin());
+  }
+
+  // on a matrix, at an offset, the frames equal drawing them as bitmaps
+  {
+    typedef NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> Matrix;
+    Matrix played(W, H + 2, 1);
+    Matrix reference(W, H + 2, 2);
+    played.setRemapFunction(&serpentine);
+    reference.setRemapFunction(&serpentine);
+
+    NeoGfxAnimation<NeoGfxProgmemReader> animation(animPalette);
+    NEOGFX_CHECK(animation.begin());
+    for(uint8_t n = 0; n < 5; n++) {
+      animation.drawFrame(played, 0, 2);
+      reference.drawRGBBitmap(0, 2, paletteFrames[n], W, H);
+      played.Show();
+      reference.Show();
+      NEOGFX_CHECK(NeoMockMethod::lastFrame(1)->data == NeoMockMethod::lastFrame(2)->data);
+    }
+  }
+
+  return neoGfxTestResult("test_animation");
+}
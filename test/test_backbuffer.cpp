@@ -0,0 +1,106 @@
+// Back buffer: drawing goes to the back buffer only, the pixels of the bus
+// stay as they are (and nothing is sent) until present(), which copies the
+// frame drawn to the bus, also with the brightness of the brightness bus.
+// A busy bus leaves the bus untouched as well.
+
+#include <vector>
+#include <NeoPixelBusGfx.h>
+#include <NeoPixelBrightnessBusGfx.h>
+#include "NeoGfxTest.h"
+
+static const int W = 8;
+static const int H = 6;
+
+NeoGfxIndex serpentine(uint16_t x, uint16_t y) {
+  return y * W + (y & 1 ? W - 1 - x : x);
+}
+
+static uint16_t bitmap[3 * 2] = { 0xF800, 0x07E0, 0x001F, 0xFFFF, 0x8410, 0x4208 };
+static const RgbColor native[2 * 2] = { RgbColor(9, 80, 200), RgbColor(255), RgbColor(0), RgbColor(1, 2, 3) };
+
+template<typename T_MATRIX>
+static std::vector<uint8_t> busPixels(T_MATRIX& matrix) {
+  return std::vector<uint8_t>(matrix.Pixels(), matrix.Pixels() + matrix.PixelsSize());
+}
+
+template<typename T_MATRIX>
+static void scene(T_MATRIX& matrix) {
+  matrix.fillScreen(0x0841);
+  matrix.drawPixel(1, 1, 0xFFFF);
+  matrix.drawPixel(2, 1, RgbColor(7, 8, 9));
+  matrix.fillRect(2, 2, 4, 3, 0xF81F);
+  matrix.drawLine(0, 0, W - 1, H - 1, 0x07E0);
+  matrix.drawRGBBitmap(5, 0, bitmap, 3, 2);
+  matrix.drawNativeBitmap(0, 4, native, 2, 2);
+  matrix.setCursor(1, 0);
+  matrix.setTextColor(0xFFE0);
+  matrix.print("B");
+  matrix.scroll(1, -1, 0x1234);
+}
+
+typedef NeoPixelBrightnessBusGfx<NeoGrbFeature, Neo800KbpsMethod> BrightnessMatrix;
+
+// only the brightness bus has a brightness
+static void dim(Adafruit_GFX&) {
+}
+
+static void dim(BrightnessMatrix& matrix) {
+  matrix.SetBrightness(128);
+}
+
+template<typename T_MATRIX>
+static T_MATRIX* newMatrix(uint8_t pin, bool backBuffer) {
+  T_MATRIX* matrix = new T_MATRIX(W, H, pin);
+  matrix->setRemapFunction(&serpentine);
+  dim(*matrix);
+  if(backBuffer) NEOGFX_CHECK(matrix->enableBackBuffer());
+  return matrix;
+}
+
+template<typename T_MATRIX>
+static void checkBackBuffer() {
+  T_MATRIX* matrix = newMatrix<T_MATRIX>(1, true);
+  T_MATRIX* reference = newMatrix<T_MATRIX>(2, false);
+
+  // the first frame: the bus keeps its pixels until present()
+  std::vector<uint8_t> before = busPixels(*matrix);
+  size_t sent = NeoMockMethod::frames().size();
+  scene(*matrix);
+  NEOGFX_CHECK(busPixels(*matrix) == before);
+  NEOGFX_CHECK_EQUAL(NeoMockMethod::frames().size(), sent);
+
+  NEOGFX_CHECK(matrix->present());
+  scene(*reference);
+  reference->Show();
+  NEOGFX_CHECK(busPixels(*matrix) == busPixels(*reference));
+  NEOGFX_CHECK(NeoMockMethod::lastFrame(1)->data == NeoMockMethod::lastFrame(2)->data);
+
+  // the next frame is drawn while the last one stays on the bus
+  std::vector<uint8_t> presented = busPixels(*matrix);
+  matrix->fillScreen(0xF800);
+  matrix->drawFastHLine(0, 3, W, 0x001F);
+  NEOGFX_CHECK(busPixels(*matrix) == presented);
+
+  // a busy bus: not presented, the bus is left as it is
+  NeoMockMethod::busy() = true;
+  NEOGFX_CHECK(!matrix->present());
+  NEOGFX_CHECK(busPixels(*matrix) == presented);
+  NeoMockMethod::busy() = false;
+
+  NEOGFX_CHECK(matrix->present());
+  reference->fillScreen(0xF800);
+  reference->drawFastHLine(0, 3, W, 0x001F);
+  reference->Show();
+  NEOGFX_CHECK(busPixels(*matrix) == busPixels(*reference));
+  NEOGFX_CHECK(NeoMockMethod::lastFrame(1)->data == NeoMockMethod::lastFrame(2)->data);
+
+  delete matrix;
+  delete reference;
+}
+
+int main() {
+  checkBackBuffer<NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> >();
+  checkBackBuffer<BrightnessMatrix>();
+
+  return neoGfxTestResult("test_backbuffer");
+}
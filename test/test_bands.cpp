@@ -0,0 +1,100 @@
+// Band rendering: the bands give the frame of drawing without bands, in
+// all rotations, with a remap function or table, a back buffer or a
+// NeoPixelBrightnessBus, and with the pass-through color and the native
+// text colors of the matrix.
+
+#include <NeoPixelBusGfx.h>
+#include <NeoPixelBrightnessBusGfx.h>
+#include "NeoGfxTest.h"
+
+static const int W = 12;
+static const int H = 10;
+
+NeoGfxIndex serpentine(uint16_t x, uint16_t y) {
+  return y * W + (y & 1 ? W - 1 - x : x);
+}
+
+typedef NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> Matrix;
+
+static void scene(Adafruit_GFX& gfx, int16_t, int16_t) {
+  gfx.fillRect(1, 1, 7, 6, 0xF800);
+  gfx.drawLine(0, 0, W - 1, H - 1, 0x07E0);
+  gfx.fillCircle(8, 5, 3, 0x001F);
+}
+
+static void text(Adafruit_GFX& gfx, int16_t, int16_t) {
+  gfx.setCursor(1, 1);
+  gfx.print("Hi");
+}
+
+enum Setup { RemapFunction, RemapTable, BackBuffer };
+
+template<typename T_MATRIX>
+static void setup(T_MATRIX& matrix, Setup s, uint8_t rotation) {
+  matrix.setRemapFunction(&serpentine);
+  if(s == RemapTable) NEOGFX_CHECK(matrix.enableRemapTable());
+  if(s == BackBuffer) NEOGFX_CHECK(matrix.enableBackBuffer());
+  matrix.setRotation(rotation);
+}
+
+// The frame sent by Show() after the bands equals the one of a single
+// threaded render.
+template<typename T_MATRIX>
+static void compareBands(uint8_t bands) {
+  for(uint8_t s = RemapFunction; s <= BackBuffer; s++) {
+    for(uint8_t rotation = 0; rotation < 4; rotation++) {
+      T_MATRIX reference(W, H, 1);
+      T_MATRIX banded(W, H, 2);
+      setup(reference, (Setup) s, rotation);
+      setup(banded, (Setup) s, rotation);
+      reference.Show();
+      banded.Show();
+
+      scene(reference, 0, H);
+      banded.renderBands(&scene, bands);
+      reference.Show();
+      banded.Show();
+      NEOGFX_CHECK(NeoMockMethod::lastFrame(1)->data == NeoMockMethod::lastFrame(2)->data);
+    }
+  }
+}
+
+int main() {
+  const RgbColor raw(3, 2, 1);
+
+  for(uint8_t bands = 1; bands <= 4; bands++) {
+    compareBands<Matrix>(bands);
+    compareBands<NeoPixelBrightnessBusGfx<NeoGrbFeature, Neo800KbpsMethod> >(bands);
+
+    // pass-through
+    {
+      Matrix banded(W, H, 0);
+      banded.setRemapFunction(&serpentine);
+      banded.setPassThruColor(raw);
+      banded.renderBands(&scene, bands);
+      banded.Show();
+      NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(serpentine(0, 0), raw));
+      NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(serpentine(2, 2), raw));
+      NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(serpentine(8, 5), raw));
+    }
+
+    // native text colors
+    {
+      Matrix reference(W, H, 1);
+      Matrix banded(W, H, 2);
+      reference.setRemapFunction(&serpentine);
+      banded.setRemapFunction(&serpentine);
+      reference.setTextColor(raw, RgbColor(0, 0, 9));
+      banded.setTextColor(raw, RgbColor(0, 0, 9));
+
+      text(reference, 0, H);
+      banded.renderBands(&text, bands);
+      reference.Show();
+      banded.Show();
+      NEOGFX_CHECK(NeoMockMethod::lastFrame(1)->data == NeoMockMethod::lastFrame(2)->data);
+      NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(serpentine(6, 1), RgbColor(0, 0, 9), 2));
+    }
+  }
+
+  return neoGfxTestResult("test_bands");
+}
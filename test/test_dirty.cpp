@@ -0,0 +1,183 @@
+// Dirty tracking: the primitives grow the dirty rect by the pixels they
+// change, clipped to the matrix and in the coordinates of the current
+// rotation, writing the same values leaves the frame clean, and
+// ShowIfDirty() skips a clean frame and clears the rect after showing one.
+
+#include <NeoPixelBusGfx.h>
+#include "NeoGfxTest.h"
+
+static const int W = 8;
+static const int H = 5;
+
+NeoGfxIndex serpentine(uint16_t x, uint16_t y) {
+  return y * W + (y & 1 ? W - 1 - x : x);
+}
+
+typedef NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> Matrix;
+
+static bool rectIs(Matrix& matrix, int16_t x, int16_t y, int16_t w, int16_t h) {
+  int16_t rx = -1, ry = -1, rw = -1, rh = -1;
+  if(!matrix.getDirtyRect(rx, ry, rw, rh)) {
+    printf("clean instead of %d, %d, %d x %d\n", x, y, w, h);
+    return false;
+  }
+  if(rx != x || ry != y || rw != w || rh != h) {
+    printf("%d, %d, %d x %d instead of %d, %d, %d x %d\n", rx, ry, rw, rh, x, y, w, h);
+    return false;
+  }
+  return true;
+}
+
+static bool clean(Matrix& matrix) {
+  int16_t x = -1, y = -1, w = -1, h = -1;
+  return !matrix.isDirty() && !matrix.getDirtyRect(x, y, w, h) && x == -1 && y == -1 && w == -1 && h == -1;
+}
+
+static Matrix* newMatrix(uint8_t rotation = 0) {
+  Matrix* matrix = new Matrix(W, H, 0);
+  matrix->setRemapFunction(&serpentine);
+  matrix->setRotation(rotation);
+  matrix->resetDirty();
+  return matrix;
+}
+
+int main() {
+  // the primitives, clipped to the matrix
+  {
+    Matrix* matrix = newMatrix();
+    NEOGFX_CHECK(clean(*matrix));
+
+    matrix->drawPixel(2, 3, 0xFFFF);
+    NEOGFX_CHECK(rectIs(*matrix, 2, 3, 1, 1));
+    matrix->drawPixel(5, 1, RgbColor(1, 2, 3));
+    NEOGFX_CHECK(rectIs(*matrix, 2, 1, 4, 3));
+
+    // outside of the matrix
+    matrix->resetDirty();
+    matrix->drawPixel(-1, 0, 0xFFFF);
+    matrix->drawPixel(W, 0, 0xFFFF);
+    matrix->drawPixel(0, H, 0xFFFF);
+    matrix->fillRect(W, 0, 3, 3, 0xFFFF);
+    NEOGFX_CHECK(clean(*matrix));
+
+    matrix->fillRect(-2, -1, 4, 3, 0xF800);
+    NEOGFX_CHECK(rectIs(*matrix, 0, 0, 2, 2));
+
+    matrix->resetDirty();
+    matrix->fillRect(6, 3, 5, 5, RgbColor(7, 0, 0));
+    NEOGFX_CHECK(rectIs(*matrix, 6, 3, 2, 2));
+
+    matrix->resetDirty();
+    matrix->drawFastHLine(-3, 2, 20, 0x07E0);
+    NEOGFX_CHECK(rectIs(*matrix, 0, 2, W, 1));
+
+    matrix->resetDirty();
+    matrix->drawFastVLine(4, -3, 20, 0x001F);
+    NEOGFX_CHECK(rectIs(*matrix, 4, 0, 1, H));
+
+    matrix->resetDirty();
+    matrix->drawLine(1, 1, 6, 3, 0x8410);
+    NEOGFX_CHECK(rectIs(*matrix, 1, 1, 6, 3));
+
+    matrix->resetDirty();
+    matrix->fillScreen(0);
+    matrix->resetDirty();
+    matrix->drawCircle(3, 2, 2, 0xFFFF);
+    NEOGFX_CHECK(rectIs(*matrix, 1, 0, 5, 5));
+
+    // writing the same values again changes nothing
+    matrix->resetDirty();
+    matrix->drawCircle(3, 2, 2, 0xFFFF);
+    matrix->drawPixel(3, 0, 0xFFFF);
+    NEOGFX_CHECK(clean(*matrix));
+
+    matrix->fillScreen(0x1234);
+    NEOGFX_CHECK(rectIs(*matrix, 0, 0, W, H));
+    matrix->resetDirty();
+    matrix->fillScreen(0x1234);
+    NEOGFX_CHECK(clean(*matrix));
+
+    delete matrix;
+  }
+
+  // in the coordinates of the current rotation
+  for(uint8_t rotation = 0; rotation < 4; rotation++) {
+    Matrix* matrix = newMatrix(rotation);
+    int16_t w = matrix->width(), h = matrix->height();
+
+    matrix->drawPixel(w - 1, 0, 0xFFFF);
+    NEOGFX_CHECK(rectIs(*matrix, w - 1, 0, 1, 1));
+
+    matrix->resetDirty();
+    matrix->fillRect(w - 2, h - 3, 10, 10, 0xF800);
+    NEOGFX_CHECK(rectIs(*matrix, w - 2, h - 3, 2, 3));
+
+    matrix->resetDirty();
+    matrix->drawFastHLine(-1, 1, w + 2, 0x07E0);
+    NEOGFX_CHECK(rectIs(*matrix, 0, 1, w, 1));
+
+    // rotating while dirty marks the whole matrix in the new coordinates
+    matrix->setRotation((rotation + 1) & 3);
+    NEOGFX_CHECK(rectIs(*matrix, 0, 0, h, w));
+
+    delete matrix;
+  }
+
+  // ShowIfDirty()
+  {
+    Matrix* matrix = newMatrix();
+    size_t sent = NeoMockMethod::frames().size();
+    NEOGFX_CHECK(!matrix->ShowIfDirty());
+    NEOGFX_CHECK_EQUAL(NeoMockMethod::frames().size(), sent);
+
+    matrix->drawPixel(1, 1, 0xFFFF);
+    NEOGFX_CHECK(matrix->ShowIfDirty());
+    NEOGFX_CHECK_EQUAL(NeoMockMethod::frames().size(), sent + 1);
+    NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(serpentine(1, 1), RgbColor(255)));
+    NEOGFX_CHECK(clean(*matrix));
+
+    NEOGFX_CHECK(!matrix->ShowIfDirty());
+    matrix->drawPixel(1, 1, 0xFFFF);
+    NEOGFX_CHECK(!matrix->ShowIfDirty());
+    NEOGFX_CHECK_EQUAL(NeoMockMethod::frames().size(), sent + 1);
+
+    // Show() clears the rect as well
+    matrix->drawPixel(2, 2, 0xFFFF);
+    matrix->Show();
+    NEOGFX_CHECK(clean(*matrix));
+    NEOGFX_CHECK(!matrix->ShowIfDirty());
+
+    delete matrix;
+  }
+
+  // ShowIfDirty() with a back buffer presents the frame
+  {
+    Matrix* matrix = newMatrix();
+    NEOGFX_CHECK(matrix->enableBackBuffer());
+    matrix->resetDirty();
+    size_t sent = NeoMockMethod::frames().size();
+    NEOGFX_CHECK(!matrix->ShowIfDirty());
+    NEOGFX_CHECK_EQUAL(NeoMockMethod::frames().size(), sent);
+
+    matrix->drawPixel(3, 2, 0xF800);
+    NEOGFX_CHECK(rectIs(*matrix, 3, 2, 1, 1));
+    NEOGFX_CHECK(matrix->ShowIfDirty());
+    NEOGFX_CHECK_EQUAL(NeoMockMethod::frames().size(), sent + 1);
+    NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(serpentine(3, 2), RgbColor(255, 0, 0)));
+    NEOGFX_CHECK(clean(*matrix));
+    NEOGFX_CHECK(!matrix->ShowIfDirty());
+
+    // a busy bus: not shown, the rect is kept for the next try
+    matrix->drawPixel(4, 0, 0x07E0);
+    NeoMockMethod::busy() = true;
+    NEOGFX_CHECK(!matrix->ShowIfDirty());
+    NEOGFX_CHECK(rectIs(*matrix, 4, 0, 1, 1));
+    NeoMockMethod::busy() = false;
+    NEOGFX_CHECK(matrix->ShowIfDirty());
+    NEOGFX_CHECK(clean(*matrix));
+
+    delete matrix;
+  }
+
+  return neoGfxTestResult("test_dirty");
+}
@@ -0,0 +1,87 @@
+// Gamma: the generated tables follow the power curve, the default keeps
+// the original 5/6 bit tables, and drawing applies the selected gamma.
+
+#include <math.h>
+#include <NeoPixelBusGfx.h>
+#include "NeoGfxTest.h"
+
+NeoGfxIndex single(uint16_t x, uint16_t) {
+  return x;
+}
+
+static uint8_t reference(uint16_t level, uint16_t maxLevel, double gamma) {
+  return (uint8_t)(pow((double) level / maxLevel, gamma) * 255.0 + 0.5);
+}
+
+template<uint16_t GAMMA>
+static void testCurve() {
+  typedef NeoGfxGamma<GAMMA> Gamma;
+
+  for(uint16_t i = 0; i < 256; i++) {
+    NEOGFX_CHECK(abs(Gamma::red8(i) - reference(i, 255, GAMMA / 100.0)) <= 1);
+    NEOGFX_CHECK_EQUAL(Gamma::green8(i), Gamma::red8(i));
+  }
+  for(uint16_t i = 0; i < 32; i++) {
+    NEOGFX_CHECK(abs(Gamma::red5(i) - reference(i, 31, GAMMA / 100.0)) <= 1);
+  }
+  for(uint16_t i = 0; i < 64; i++) {
+    NEOGFX_CHECK(abs(Gamma::green6(i) - reference(i, 63, GAMMA / 100.0)) <= 1);
+  }
+  NEOGFX_CHECK_EQUAL(Gamma::red8(0), 0);
+  NEOGFX_CHECK_EQUAL(Gamma::red8(255), 255);
+}
+
+int main() {
+  testCurve<100>();
+  testCurve<220>();
+  testCurve<260>();
+
+  // gamma 1.0 leaves full colors as they are
+  for(uint16_t i = 0; i < 256; i++) {
+    NEOGFX_CHECK_EQUAL(NeoGfxGamma<100>::red8(i), i);
+  }
+
+  // per channel gamma
+  typedef NeoGfxGamma<100, 220, 260, 280> Mixed;
+  NEOGFX_CHECK_EQUAL(Mixed::red8(128), NeoGfxGamma<100>::red8(128));
+  NEOGFX_CHECK_EQUAL(Mixed::green8(128), NeoGfxGamma<220>::red8(128));
+  NEOGFX_CHECK_EQUAL(Mixed::blue8(128), NeoGfxGamma<260>::red8(128));
+  NEOGFX_CHECK_EQUAL(Mixed::white8(128), NeoGfxGamma<280>::red8(128));
+
+  // the default uses the original tables for 16-bit colors
+  for(uint8_t i = 0; i < 32; i++) {
+    NEOGFX_CHECK_EQUAL(NeoGfxDefaultGamma::red5(i), gamma5[i]);
+    NEOGFX_CHECK_EQUAL(NeoGfxDefaultGamma::blue5(i), gamma5[i]);
+  }
+  for(uint8_t i = 0; i < 64; i++) {
+    NEOGFX_CHECK_EQUAL(NeoGfxDefaultGamma::green6(i), gamma6[i]);
+  }
+  NEOGFX_CHECK_EQUAL(NeoGfxDefaultGamma::red8(128), NeoGfxGamma<260>::red8(128));
+
+  // drawing applies the gamma of the matrix
+  {
+    NeoPixelBusGfx<NeoRgbFeature, Neo800KbpsMethod> matrix(3, 1, 0);
+    matrix.setRemapFunction(&single);
+    matrix.drawPixel(0, 0, 0xF800);
+    matrix.drawPixel(1, 0, (16 << 11) | (33 << 5) | 7);
+    matrix.drawPixel(2, 0, matrix.Color(255, 255, 255));
+    matrix.Show();
+
+    NEOGFX_CHECK(neoGfxWireIs<NeoRgbFeature>(0, RgbColor(0xFF, gamma6[0], 0)));
+    NEOGFX_CHECK(neoGfxWireIs<NeoRgbFeature>(1, RgbColor(gamma5[16], gamma6[33], gamma5[7])));
+    NEOGFX_CHECK(neoGfxWireIs<NeoRgbFeature>(2, RgbColor(0xFF)));
+    NEOGFX_CHECK_EQUAL(matrix.expandColor((16 << 11) | (33 << 5) | 7), ((uint32_t) gamma5[16] << 16) | (gamma6[33] << 8) | gamma5[7]);
+  }
+  {
+    NeoPixelBusGfx<NeoRgbFeature, Neo800KbpsMethod, NeoGfxRemapLayout, NeoGfxGamma<220>> matrix(1, 1, 0);
+    matrix.setRemapFunction(&single);
+    matrix.drawPixel(0, 0, (16 << 11) | (33 << 5) | 7);
+    matrix.Show();
+    NEOGFX_CHECK(neoGfxWireIs<NeoRgbFeature>(0, RgbColor(NeoGfxGamma<220>::red5(16), NeoGfxGamma<220>::green6(33), NeoGfxGamma<220>::blue5(7))));
+
+    RgbColor corrected = matrix.correctGamma(RgbColor(10, 128, 250));
+    NEOGFX_CHECK(corrected == RgbColor(NeoGfxGamma<220>::red8(10), NeoGfxGamma<220>::red8(128), NeoGfxGamma<220>::red8(250)));
+  }
+
+  return neoGfxTestResult("test_gamma");
+}
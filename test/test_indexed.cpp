@@ -0,0 +1,112 @@
+// Indexed colors: the 16-bit colors, drawRGBBitmap and drawGrayscaleBitmap
+// give palette indices, the colors of the feature, drawRGB24Bitmap,
+// drawNativeBitmap and 3-channel stream packets draw nothing.
+
+#include <NeoPixelBusGfx.h>
+#include "NeoGfxTest.h"
+
+static const int W = 4;
+static const int H = 3;
+
+NeoGfxIndex rowMajor(uint16_t x, uint16_t y) {
+  return y * W + x;
+}
+
+typedef NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> Matrix;
+
+static const RgbColor blue(0, 0, 64);
+static const RgbColor red(64, 0, 0);
+static const RgbColor green(0, 64, 0);
+
+static Matrix* indexedMatrix() {
+  Matrix* matrix = new Matrix(W, H, 0);
+  matrix->setRemapFunction(&rowMajor);
+  NEOGFX_CHECK(matrix->enableIndexedColor(4));
+  matrix->setPaletteColor(1, blue);
+  matrix->setPaletteColor(2, red);
+  matrix->setPaletteColor(3, green);
+  matrix->fillScreen(1);
+  return matrix;
+}
+
+static bool allAre(RgbColor color) {
+  bool same = true;
+  for(uint16_t i = 0; i < W * H; i++) {
+    same = same && neoGfxWireIs<NeoGrbFeature>(i, color);
+  }
+  return same;
+}
+
+int main() {
+  // the colors of the feature draw nothing
+  {
+    Matrix* matrix = indexedMatrix();
+    const RgbColor white(255);
+    matrix->drawPixel(0, 0, white);
+    matrix->fillScreen(white);
+    matrix->drawFastHLine(0, 1, W, white);
+    matrix->drawFastVLine(1, 0, H, white);
+    matrix->drawLine(0, 0, W - 1, H - 1, white);
+    matrix->drawRect(0, 0, W, H, white);
+    matrix->fillRect(0, 0, W, H, white);
+    matrix->drawCircle(1, 1, 1, white);
+    matrix->fillCircle(1, 1, 1, white);
+    matrix->scroll(1, 0, white);
+    matrix->Show();
+    NEOGFX_CHECK(allAre(blue));
+
+    // neither does native text, 16-bit text is drawn with its index
+    matrix->setTextColor(white, RgbColor(0));
+    matrix->setCursor(0, 0);
+    matrix->print("A");
+    matrix->Show();
+    NEOGFX_CHECK(allAre(blue));
+    delete matrix;
+  }
+
+  // 24-bit and native bitmaps draw nothing
+  {
+    Matrix* matrix = indexedMatrix();
+    uint8_t rgb[W * H * 3];
+    memset(rgb, 200, sizeof(rgb));
+    RgbColor native[W * H];
+    for(uint16_t i = 0; i < W * H; i++) native[i] = RgbColor(200);
+
+    matrix->drawRGB24Bitmap(0, 0, rgb, W, H);
+    matrix->drawNativeBitmap(0, 0, native, W, H);
+    matrix->Show();
+    NEOGFX_CHECK(allAre(blue));
+    delete matrix;
+  }
+
+  // 16-bit and grayscale bitmaps carry indices
+  {
+    Matrix* matrix = indexedMatrix();
+    uint16_t indices[2] = { 2, 3 };
+    uint8_t gray[2] = { 3, 2 };
+    matrix->drawRGBBitmap(0, 0, indices, 2, 1);
+    matrix->drawGrayscaleBitmap(0, 1, gray, 2, 1);
+    matrix->Show();
+    NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(rowMajor(0, 0), red));
+    NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(rowMajor(1, 0), green));
+    NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(rowMajor(0, 1), green));
+    NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(rowMajor(1, 1), red));
+    NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(rowMajor(2, 1), blue));
+    delete matrix;
+  }
+
+  // streams: 2-channel packets are indices, 3-channel packets are dropped
+  {
+    Matrix* matrix = indexedMatrix();
+    const uint8_t rgb[] = { 'N', 'G', 0, 3, 0, 0, 1, 0, 200, 200, 200 };
+    const uint8_t index[] = { 'N', 'G', 0, 2, 1, 0, 1, 0, 2, 0 };
+    matrix->feedStream(rgb, sizeof(rgb));
+    matrix->feedStream(index, sizeof(index));
+    matrix->Show();
+    NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(0, blue));
+    NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(1, red));
+    delete matrix;
+  }
+
+  return neoGfxTestResult("test_indexed");
+}
@@ -0,0 +1,104 @@
+// Large matrices (built with NEOGFX_LARGE_MATRIX): 512x256 on four buses,
+// rows and columns above 255, 32-bit remap tables and remap functions
+// returning the 16-bit indices.
+
+#include <NeoPixelMultiBusGfx.h>
+#include <NeoPixelBusGfx.h>
+#include "NeoGfxTest.h"
+
+static const int W = 512;
+static const int H = 256;
+static const uint8_t BUSES = 4;
+static const int STRIP = H / BUSES;
+
+NeoGfxIndex rowMajor(uint16_t x, uint16_t y) {
+  return (NeoGfxIndex) y * W + x;
+}
+
+// a remap function as written for the 16-bit indices
+static const int SMALL_W = 300;
+uint16_t smallRowMajor(uint16_t x, uint16_t y) {
+  return y * SMALL_W + x;
+}
+
+static const uint8_t pins[BUSES] = { 0, 1, 2, 3 };
+
+static bool wireIs(int16_t x, int16_t y, RgbColor color) {
+  return neoGfxWireIs<NeoGrbFeature>(rowMajor(x, y % STRIP), color, pins[y / STRIP]);
+}
+
+int main() {
+  static_assert(sizeof(NeoGfxIndex) == 4, "built without NEOGFX_LARGE_MATRIX");
+  const RgbColor white(255);
+  const RgbColor black(0);
+
+  // pixels beyond 255 in all rotations reach their bus and index
+  {
+    NeoPixelMultiBusGfx<NeoGrbFeature, Neo800KbpsMethod, BUSES> matrix(W, H, pins);
+    matrix.setRemapFunction(&rowMajor);
+    NEOGFX_CHECK_EQUAL(matrix.Bus(3).PixelCount(), W * STRIP);
+
+    const int16_t points[][2] = { { 0, 0 }, { 511, 255 }, { 300, 200 }, { 256, 64 }, { 511, 0 }, { 5, 255 } };
+    for(uint8_t rotation = 0; rotation < 4; rotation++) {
+      matrix.setRotation(rotation);
+      for(uint8_t p = 0; p < sizeof(points) / sizeof(points[0]); p++) {
+        int16_t x = points[p][0], y = points[p][1];
+        int16_t rx = x, ry = y;
+        switch(rotation) {
+        case 1: rx = y; ry = W - 1 - x; break;
+        case 2: rx = W - 1 - x; ry = H - 1 - y; break;
+        case 3: rx = H - 1 - y; ry = x; break;
+        }
+
+        matrix.clear();
+        matrix.drawPixel(rx, ry, 0xFFFF);
+        matrix.Show();
+        NEOGFX_CHECK(wireIs(x, y, white));
+      }
+    }
+  }
+
+  // a rect over the strip borders and beyond column 255
+  {
+    NeoPixelMultiBusGfx<NeoGrbFeature, Neo800KbpsMethod, BUSES> matrix(W, H, pins);
+    matrix.setRemapFunction(&rowMajor);
+    matrix.enableRemapTable();
+    matrix.fillRect(250, 60, 20, 10, 0xFFFF);
+    matrix.Show();
+
+    for(int16_t y = 55; y < 75; y++) {
+      for(int16_t x = 245; x < 275; x++) {
+        bool lit = x >= 250 && x < 270 && y >= 60 && y < 70;
+        NEOGFX_CHECK(wireIs(x, y, lit ? white : black));
+      }
+    }
+  }
+
+  // remap table with 32-bit entries, and a 16-bit remap function
+  {
+    static NeoGfxIndex table[SMALL_W * 2];
+    for(uint16_t y = 0; y < 2; y++) {
+      for(uint16_t x = 0; x < SMALL_W; x++) {
+        table[y * SMALL_W + x] = (1 - y) * SMALL_W + x;
+      }
+    }
+
+    NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> matrix(SMALL_W, 2, 0);
+    matrix.setRemapTable_P(table);
+    matrix.drawPixel(299, 1, 0xFFFF);
+    matrix.Show();
+    NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(299, white));
+
+    matrix.setRemapTable_P(NULL);
+    matrix.setRemapFunction(&smallRowMajor);
+    matrix.clear();
+    matrix.drawPixel(299, 1, 0xFFFF);
+    matrix.drawFastHLine(256, 0, 10, 0xFFFF);
+    matrix.Show();
+    NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(SMALL_W + 299, white));
+    NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(260, white));
+    NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(299, black));
+  }
+
+  return neoGfxTestResult("test_large");
+}
@@ -0,0 +1,85 @@
+// Multiple buses: the strips split the unrotated matrix, the last strip
+// gets the rows left over if the height is not a multiple of the buses.
+
+#include <NeoPixelMultiBusGfx.h>
+#include "NeoGfxTest.h"
+
+static const int W = 4;
+static const int H = 10;
+static const uint8_t BUSES = 3;
+
+NeoGfxIndex rowMajor(uint16_t x, uint16_t y) {
+  return y * W + x;
+}
+
+typedef NeoPixelMultiBusGfx<NeoGrbFeature, Neo800KbpsMethod, BUSES> Matrix;
+
+static const uint8_t pins[BUSES] = { 0, 1, 2 };
+
+// The bus and index of the unrotated pixel x/y.
+static bool wireIs(int16_t x, int16_t y, RgbColor color) {
+  uint8_t bus = y / (H / BUSES);
+  if(bus >= BUSES) bus = BUSES - 1;
+  return neoGfxWireIs<NeoGrbFeature>(rowMajor(x, y - bus * (H / BUSES)), color, pins[bus]);
+}
+
+int main() {
+  const RgbColor white(255);
+  const RgbColor black(0);
+
+  {
+    Matrix matrix(W, H, pins);
+    NEOGFX_CHECK_EQUAL(matrix.Bus(0).PixelCount(), W * 3);
+    NEOGFX_CHECK_EQUAL(matrix.Bus(1).PixelCount(), W * 3);
+    NEOGFX_CHECK_EQUAL(matrix.Bus(2).PixelCount(), W * 4);
+  }
+
+  // every pixel reaches its bus, in all rotations
+  for(uint8_t rotation = 0; rotation < 4; rotation++) {
+    for(int16_t y = 0; y < H; y++) {
+      for(int16_t x = 0; x < W; x++) {
+        Matrix matrix(W, H, pins);
+        matrix.setRemapFunction(&rowMajor);
+        matrix.setRotation(rotation);
+
+        int16_t rx = x, ry = y;
+        switch(rotation) {
+        case 1: rx = y; ry = W - 1 - x; break;
+        case 2: rx = W - 1 - x; ry = H - 1 - y; break;
+        case 3: rx = H - 1 - y; ry = x; break;
+        }
+        matrix.drawPixel(rx, ry, 0xFFFF);
+        matrix.Show();
+        NEOGFX_CHECK(wireIs(x, y, white));
+      }
+    }
+  }
+
+  // a rect over all strips covers the rows left over
+  {
+    Matrix matrix(W, H, pins);
+    matrix.setRemapFunction(&rowMajor);
+    matrix.fillRect(1, 2, 2, H, 0xFFFF);
+    matrix.Show();
+
+    for(int16_t y = 0; y < H; y++) {
+      for(int16_t x = 0; x < W; x++) {
+        bool lit = x >= 1 && x < 3 && y >= 2;
+        NEOGFX_CHECK(wireIs(x, y, lit ? white : black));
+      }
+    }
+  }
+
+  // fewer rows than buses: the rows are on the last bus
+  {
+    NeoPixelMultiBusGfx<NeoGrbFeature, Neo800KbpsMethod, BUSES> matrix(W, 2, pins);
+    matrix.setRemapFunction(&rowMajor);
+    NEOGFX_CHECK_EQUAL(matrix.Bus(0).PixelCount(), 0);
+    NEOGFX_CHECK_EQUAL(matrix.Bus(2).PixelCount(), W * 2);
+    matrix.fillRect(0, 1, W, 1, 0xFFFF);
+    matrix.Show();
+    NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(W, white, pins[2]));
+  }
+
+  return neoGfxTestResult("test_multibus");
+}
@@ -0,0 +1,66 @@
+// Output table: every channel byte goes through the gamma of its channel
+// and the brightness, bytes which are no channel keep what the feature
+// writes (the DotStar prefix, the LPD8806 flag bits).
+
+#include <NeoPixelBusGfx.h>
+#include <NeoPixelBrightnessBusGfx.h>
+#include "NeoGfxTest.h"
+
+NeoGfxIndex single(uint16_t x, uint16_t) {
+  return x;
+}
+
+template<typename T_GAMMA>
+static uint8_t output(uint8_t channel, uint8_t level, uint8_t brightness) {
+  uint8_t corrected = channel == 0 ? T_GAMMA::red8(level) :
+                      channel == 1 ? T_GAMMA::green8(level) :
+                      channel == 2 ? T_GAMMA::blue8(level) : T_GAMMA::white8(level);
+  return ((uint32_t)corrected * (brightness + 1) * 256) >> 16;
+}
+
+int main() {
+  // a gamma per channel
+  {
+    typedef NeoGfxGamma<100, 220, 260, 280> Gamma;
+    NeoPixelBusGfx<NeoGrbwFeature, Neo800KbpsMethod, NeoGfxRemapLayout, Gamma> matrix(1, 1, 0);
+    matrix.setRemapFunction(&single);
+    NEOGFX_CHECK(matrix.enableOutputTable());
+    matrix.drawPixel(0, 0, RgbwColor(128, 128, 128, 128));
+    NEOGFX_CHECK(matrix.present());
+    NEOGFX_CHECK(neoGfxWireIs<NeoGrbwFeature>(0, RgbwColor(output<Gamma>(0, 128, 255), output<Gamma>(1, 128, 255), output<Gamma>(2, 128, 255), output<Gamma>(3, 128, 255))));
+  }
+
+  // the DotStar prefix stays 0xFF
+  {
+    NeoPixelBusGfx<DotStarBgrFeature, DotStarMethod> matrix(2, 1, 0, 0);
+    matrix.setRemapFunction(&single);
+    NEOGFX_CHECK(matrix.enableOutputTable(128));
+    matrix.fillScreen(RgbColor(200, 100, 50));
+    NEOGFX_CHECK(matrix.present());
+
+    RgbColor expected(output<NeoGfxDefaultGamma>(0, 200, 128), output<NeoGfxDefaultGamma>(1, 100, 128), output<NeoGfxDefaultGamma>(2, 50, 128));
+    NEOGFX_CHECK(neoGfxWireIs<DotStarBgrFeature>(0, expected));
+    NEOGFX_CHECK(neoGfxWireIs<DotStarBgrFeature>(1, expected));
+
+    matrix.setOutputBrightness(0);
+    NEOGFX_CHECK(matrix.present());
+    NEOGFX_CHECK(neoGfxWireIs<DotStarBgrFeature>(0, RgbColor(0)));
+  }
+
+  // the LPD8806 keeps the high bit, the 7 bits of a channel are mapped
+  {
+    NeoPixelBrightnessBusGfx<Lpd8806GrbFeature, DotStarMethod> matrix(1, 1, 0, 0);
+    matrix.setRemapFunction(&single);
+    NEOGFX_CHECK(matrix.enableOutputTable());
+    matrix.drawPixel(0, 0, RgbColor(201, 101, 1));
+    NEOGFX_CHECK(matrix.present());
+    NEOGFX_CHECK(neoGfxWireIs<Lpd8806GrbFeature>(0, RgbColor(output<NeoGfxDefaultGamma>(0, 201, 255), output<NeoGfxDefaultGamma>(1, 101, 255), 0)));
+
+    const uint8_t* pixel = neoGfxWirePixel(0, Lpd8806GrbFeature::PixelSize);
+    for(uint8_t i = 0; pixel && i < Lpd8806GrbFeature::PixelSize; i++) {
+      NEOGFX_CHECK(pixel[i] & 0x80);
+    }
+  }
+
+  return neoGfxTestResult("test_output");
+}
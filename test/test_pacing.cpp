@@ -0,0 +1,145 @@
+// Frame pacing with the clock and the bus driven by the test: frames on
+// time, frames missed while rendering late are skipped, a busy bus defers
+// the frame due, the frames per second and the jitter of the intervals.
+
+#include <NeoPixelBusGfx.h>
+#include "NeoGfxTest.h"
+
+typedef NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> Matrix;
+
+static const uint32_t INTERVAL = 10000; // 100 fps
+
+static Matrix* matrix;
+static uint32_t rendered;
+static uint32_t lastDelta;
+
+static void render(uint32_t deltaMicros) {
+  matrix->drawPixel(0, 0, rendered & 1 ? 0xFFFF : 0xF800);
+  rendered++;
+  lastDelta = deltaMicros;
+}
+
+// Calls update() at the time now, returns true if a frame was rendered.
+static bool updateAt(unsigned long now) {
+  neoShimSetMicros(now);
+  uint32_t before = rendered;
+  bool result = matrix->update();
+  NEOGFX_CHECK_EQUAL(result, rendered != before);
+  return result;
+}
+
+static void start(unsigned long now) {
+  delete matrix;
+  matrix = new Matrix(4, 4, 0);
+  rendered = 0;
+  neoShimSetMicros(now);
+  matrix->setFrameRate(100);
+  matrix->setRenderCallback(&render);
+}
+
+int main() {
+  // on time: a frame per interval, nothing in between
+  {
+    start(0);
+    NEOGFX_CHECK(updateAt(0));
+    NEOGFX_CHECK_EQUAL(lastDelta, 0);
+    NEOGFX_CHECK(!updateAt(5000));
+    NEOGFX_CHECK(!updateAt(9999));
+    size_t sent = NeoMockMethod::frames().size();
+    NEOGFX_CHECK(updateAt(10000));
+    NEOGFX_CHECK_EQUAL(lastDelta, INTERVAL);
+    NEOGFX_CHECK_EQUAL(NeoMockMethod::frames().size(), sent + 1);
+    NEOGFX_CHECK(updateAt(20000));
+
+    NEOGFX_CHECK_EQUAL(matrix->getFrameStats().frames, 3);
+    NEOGFX_CHECK_EQUAL(matrix->getFrameStats().skipped, 0);
+    NEOGFX_CHECK_EQUAL(matrix->getFrameStats().maxJitterMicros, 0);
+  }
+
+  // late: the frames missed completely are skipped, the schedule is kept
+  {
+    start(0);
+    NEOGFX_CHECK(updateAt(0));
+    NEOGFX_CHECK(updateAt(35000));                // due at 10000, 20000 and 30000
+    NEOGFX_CHECK_EQUAL(matrix->getFrameStats().skipped, 2);
+    NEOGFX_CHECK_EQUAL(lastDelta, 35000);
+    NEOGFX_CHECK(!updateAt(39999));
+    NEOGFX_CHECK(updateAt(40000));
+    NEOGFX_CHECK_EQUAL(matrix->getFrameStats().skipped, 2);
+    NEOGFX_CHECK_EQUAL(matrix->getFrameStats().frames, 3);
+  }
+
+  // busy bus: the frame due is rendered as soon as the bus is ready,
+  // without skipping and without moving the schedule
+  {
+    start(0);
+    NEOGFX_CHECK(updateAt(0));
+    NeoMockMethod::busy() = true;
+    NEOGFX_CHECK(!updateAt(10000));
+    NEOGFX_CHECK(!updateAt(13000));
+    NeoMockMethod::busy() = false;
+    NEOGFX_CHECK(updateAt(13500));
+    NEOGFX_CHECK_EQUAL(lastDelta, 13500);
+    NEOGFX_CHECK(!updateAt(19999));
+    NEOGFX_CHECK(updateAt(20000));
+    NEOGFX_CHECK_EQUAL(matrix->getFrameStats().skipped, 0);
+    NEOGFX_CHECK_EQUAL(matrix->getFrameStats().frames, 3);
+  }
+
+  // the rate set long before the first update: nothing is skipped
+  {
+    start(1000);
+    NEOGFX_CHECK(updateAt(500000));
+    NEOGFX_CHECK_EQUAL(matrix->getFrameStats().skipped, 0);
+    NEOGFX_CHECK(!updateAt(505000));
+    NEOGFX_CHECK(updateAt(510000));
+    NEOGFX_CHECK_EQUAL(matrix->getFrameStats().skipped, 0);
+  }
+
+  // frames per second: counted per full second from the first frame
+  {
+    start(0);
+    for(unsigned long now = 0; now < 1000000; now += INTERVAL) {
+      NEOGFX_CHECK(updateAt(now));
+    }
+    NEOGFX_CHECK_EQUAL(matrix->getFrameStats().fps, 0);
+    NEOGFX_CHECK(updateAt(1000000));
+    NEOGFX_CHECK_EQUAL(matrix->getFrameStats().fps, 100);
+
+    // at half the rate (every other frame skipped)
+    for(unsigned long now = 1000000 + 2 * INTERVAL; now <= 2000000; now += 2 * INTERVAL) {
+      NEOGFX_CHECK(updateAt(now));
+    }
+    NEOGFX_CHECK_EQUAL(matrix->getFrameStats().fps, 50);
+    NEOGFX_CHECK_EQUAL(matrix->getFrameStats().skipped, 50);
+  }
+
+  // jitter: the average over the last 16 intervals and the largest
+  {
+    start(0);
+    NEOGFX_CHECK(updateAt(0));
+    NEOGFX_CHECK(updateAt(12000));               // 2000 late
+    NEOGFX_CHECK_EQUAL(matrix->getFrameStats().maxJitterMicros, 2000);
+    NEOGFX_CHECK_EQUAL(matrix->getFrameStats().jitterMicros, 2000 / 16);
+    NEOGFX_CHECK(updateAt(20000));               // 8000 after the last one
+    NEOGFX_CHECK_EQUAL(matrix->getFrameStats().maxJitterMicros, 2000);
+    NEOGFX_CHECK_EQUAL(matrix->getFrameStats().jitterMicros, 2000 / 16 - 2000 / 16 / 16 + 2000 / 16);
+
+    matrix->resetFrameStats();
+    NEOGFX_CHECK_EQUAL(matrix->getFrameStats().frames, 0);
+    NEOGFX_CHECK_EQUAL(matrix->getFrameStats().maxJitterMicros, 0);
+  }
+
+  // without a frame rate every update renders
+  {
+    start(0);
+    matrix->setFrameRate(0);
+    NEOGFX_CHECK(updateAt(0));
+    NEOGFX_CHECK(updateAt(1));
+    NEOGFX_CHECK(updateAt(1));
+    NEOGFX_CHECK_EQUAL(matrix->getFrameStats().skipped, 0);
+  }
+
+  delete matrix;
+  return neoGfxTestResult("test_pacing");
+}
@@ -0,0 +1,125 @@
+// Pass-through and native colors: raw colors of the feature reach the
+// wire without gamma correction, 16-bit colors are back to normal after.
+
+#include <NeoPixelBusGfx.h>
+#include "NeoGfxTest.h"
+
+static const int W = 8;
+static const int H = 4;
+
+NeoGfxIndex rowMajor(uint16_t x, uint16_t y) {
+  return y * W + x;
+}
+
+template<typename T_COLOR_FEATURE>
+static void testFeature(typename T_COLOR_FEATURE::ColorObject raw) {
+  typedef NeoPixelBusGfx<T_COLOR_FEATURE, Neo800KbpsMethod> Matrix;
+  typedef typename T_COLOR_FEATURE::ColorObject Color;
+
+  Matrix matrix(W, H, 0);
+  matrix.setRemapFunction(&rowMajor);
+  const Color gray = RgbColor(HtmlColor(Matrix::expandColor(0x8410)));
+
+  // pass-through replaces the 16-bit color of every primitive
+  matrix.setPassThruColor(raw);
+  matrix.drawPixel(0, 0, 0x8410);
+  matrix.fillRect(1, 0, 2, 1, 0x8410);
+  matrix.drawLine(3, 0, 4, 0, 0x8410);
+  matrix.setPassThruColor();
+  matrix.drawPixel(5, 0, 0x8410);
+  matrix.Show();
+
+  for(uint16_t i = 0; i < 5; i++) {
+    NEOGFX_CHECK(neoGfxWireIs<T_COLOR_FEATURE>(i, raw));
+  }
+  NEOGFX_CHECK(neoGfxWireIs<T_COLOR_FEATURE>(5, gray));
+
+  // the overloads taking a color of the feature
+  matrix.clear();
+  matrix.drawPixel(0, 1, raw);
+  matrix.drawFastHLine(1, 1, 2, raw);
+  matrix.drawFastVLine(3, 1, 2, raw);
+  matrix.fillRect(4, 1, 2, 2, raw);
+  matrix.drawPixel(7, 3, 0x8410);
+  matrix.Show();
+
+  const uint16_t lit[] = { W, W + 1, W + 2, W + 3, 2 * W + 3, W + 4, W + 5, 2 * W + 4, 2 * W + 5 };
+  for(uint16_t i = 0; i < sizeof(lit) / sizeof(lit[0]); i++) {
+    NEOGFX_CHECK(neoGfxWireIs<T_COLOR_FEATURE>(lit[i], raw));
+  }
+  NEOGFX_CHECK(neoGfxWireIs<T_COLOR_FEATURE>(0, Color(RgbColor(0))));
+  NEOGFX_CHECK(neoGfxWireIs<T_COLOR_FEATURE>(W * H - 1, gray));
+
+  // native text colors, transparent and with background
+  Matrix text(W, H, 1);
+  text.setRemapFunction(&rowMajor);
+  Matrix reference(W, H, 2);
+  reference.setRemapFunction(&rowMajor);
+
+  text.setTextColor(raw);
+  text.print("A");
+  reference.setPassThruColor(raw);
+  reference.print("A");
+  reference.setPassThruColor();
+  text.Show();
+  reference.Show();
+  NEOGFX_CHECK(NeoMockMethod::lastFrame(1)->data == NeoMockMethod::lastFrame(2)->data);
+
+  // a 16-bit text color ends the native one
+  text.clear();
+  reference.clear();
+  text.setTextColor(0x8410);
+  text.setCursor(0, 0);
+  text.print("A");
+  reference.setTextColor(0x8410);
+  reference.setCursor(0, 0);
+  reference.print("A");
+  text.Show();
+  reference.Show();
+  NEOGFX_CHECK(NeoMockMethod::lastFrame(1)->data == NeoMockMethod::lastFrame(2)->data);
+
+  // native text with background, drawn from the glyph cache
+  text.clear();
+  reference.clear();
+  text.enableGlyphCache();
+  text.setCursor(0, 0);
+  text.setTextColor(raw, Color(RgbColor(0, 0, 5)));
+  text.print("A");
+  reference.setCursor(0, 0);
+  reference.setPassThruColor(Color(RgbColor(0, 0, 5)));
+  reference.fillRect(0, 0, 6, 8, 0);
+  reference.setPassThruColor(raw);
+  reference.setTextColor(0x8410);
+  reference.print("A");
+  reference.setPassThruColor();
+  text.Show();
+  reference.Show();
+  NEOGFX_CHECK(NeoMockMethod::lastFrame(1)->data == NeoMockMethod::lastFrame(2)->data);
+
+  // the other primitives match pass-through, and a 16-bit 0xFFFF drawn
+  // in between is a plain white
+  text.clear();
+  reference.clear();
+  text.drawLine(0, 0, 7, 3, raw);
+  text.drawRect(5, 0, 3, 3, raw);
+  text.drawCircle(2, 2, 1, raw);
+  text.fillCircle(5, 2, 1, raw);
+  text.drawPixel(7, 3, 0xFFFF);
+  reference.setPassThruColor(raw);
+  reference.drawLine(0, 0, 7, 3, 0);
+  reference.drawRect(5, 0, 3, 3, 0);
+  reference.drawCircle(2, 2, 1, 0);
+  reference.fillCircle(5, 2, 1, 0);
+  reference.setPassThruColor();
+  reference.drawPixel(7, 3, 0xFFFF);
+  text.Show();
+  reference.Show();
+  NEOGFX_CHECK(NeoMockMethod::lastFrame(1)->data == NeoMockMethod::lastFrame(2)->data);
+  NEOGFX_CHECK(neoGfxWireIs<T_COLOR_FEATURE>(W * H - 1, Color(RgbColor(255)), 1));
+}
+
+int main() {
+  testFeature<NeoGrbFeature>(RgbColor(3, 2, 1));
+  testFeature<NeoGrbwFeature>(RgbwColor(3, 2, 1, 7));
+  return neoGfxTestResult("test_passthrough");
+}
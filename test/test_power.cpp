@@ -0,0 +1,118 @@
+// Power estimate: the sums kept up to date while drawing equal a recount
+// of all pixels after every primitive, and bands (which each count their
+// own pixels) give the same sums as drawing without bands, also with the
+// output table counting gamma corrected values.
+
+#include <NeoPixelBusGfx.h>
+#include <NeoPixelBrightnessBusGfx.h>
+#include "NeoGfxTest.h"
+
+static const int W = 16;
+static const int H = 12;
+
+NeoGfxIndex serpentine(uint16_t x, uint16_t y) {
+  return y * W + (y & 1 ? W - 1 - x : x);
+}
+
+static uint16_t bitmap[5 * 4];
+static const RgbColor native[2 * 2] = { RgbColor(9, 80, 200), RgbColor(255), RgbColor(0), RgbColor(1, 2, 3) };
+
+enum Setup { Plain, OutputTable, BackBuffer };
+static const char* setupNames[] = { "plain", "output table", "back buffer" };
+
+static void scene(Adafruit_GFX& gfx, int16_t, int16_t) {
+  gfx.fillRect(1, 1, 9, 7, 0xF800);
+  gfx.drawLine(0, 0, W - 1, H - 1, 0x07E0);
+  gfx.fillCircle(10, 6, 4, 0x841F);
+  gfx.drawRGBBitmap(9, 2, bitmap, 5, 4);
+  gfx.setCursor(2, 3);
+  gfx.setTextColor(0xFFE0);
+  gfx.print("P");
+}
+
+template<typename T_MATRIX>
+static bool sumsMatchRecount(T_MATRIX& matrix) {
+  uint32_t kept[3], counted[3];
+  matrix.getPowerSums(kept);
+  uint32_t demand = matrix.getPowerDemand();
+  matrix.recountPower();
+  matrix.getPowerSums(counted);
+  return memcmp(kept, counted, sizeof(kept)) == 0 && demand == matrix.getPowerDemand();
+}
+
+template<typename T_MATRIX>
+static void setup(T_MATRIX& matrix, Setup s) {
+  matrix.setRemapFunction(&serpentine);
+  switch(s) {
+  case OutputTable: NEOGFX_CHECK(matrix.enableOutputTable()); break;
+  case BackBuffer:  NEOGFX_CHECK(matrix.enableBackBuffer()); break;
+  default: break;
+  }
+  matrix.enablePowerEstimate();
+}
+
+#define CHECK_STEP(step) \
+  do { \
+    step; \
+    if(!sumsMatchRecount(matrix)) { \
+      printf("%s: %s\n", setupNames[s], #step); \
+      NEOGFX_CHECK(!"estimate differs from recount"); \
+    } \
+  } while(0)
+
+template<typename T_MATRIX>
+static void checkPrimitives() {
+  for(uint8_t s = Plain; s <= BackBuffer; s++) {
+    T_MATRIX matrix(W, H, 0);
+    setup(matrix, (Setup) s);
+
+    CHECK_STEP(matrix.fillScreen(0x1234));
+    CHECK_STEP(matrix.drawPixel(3, 4, 0xFFFF));
+    CHECK_STEP(matrix.drawPixel(3, 4, RgbColor(7, 8, 9)));
+    CHECK_STEP(matrix.fillRect(2, 2, 7, 5, 0xF81F));
+    CHECK_STEP(matrix.fillRect(-3, 8, 30, 2, RgbColor(100, 0, 50)));
+    CHECK_STEP(matrix.drawFastHLine(0, 11, W, 0x07FF));
+    CHECK_STEP(matrix.drawFastVLine(15, 0, H, 0x001F));
+    CHECK_STEP(matrix.drawLine(0, 0, W - 1, H - 1, 0xFFE0));
+    CHECK_STEP(matrix.drawCircle(8, 6, 5, 0x8410));
+    CHECK_STEP(matrix.fillCircle(8, 6, 3, RgbColor(0, 255, 0)));
+    CHECK_STEP(matrix.drawRGBBitmap(5, 5, bitmap, 5, 4));
+    CHECK_STEP(matrix.drawNativeBitmap(14, 10, native, 2, 2));
+    CHECK_STEP(matrix.scroll(3, -2, 0x4208));
+    CHECK_STEP(matrix.setRotation(1));
+    CHECK_STEP(matrix.scroll(-1, 1, RgbColor(2, 4, 6)));
+    CHECK_STEP(matrix.setCursor(1, 1); matrix.print("Hi"));
+    CHECK_STEP(matrix.fillScreen(0));
+  }
+}
+
+int main() {
+  for(uint8_t i = 0; i < 5 * 4; i++) {
+    bitmap[i] = i * 3271;
+  }
+
+  checkPrimitives<NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> >();
+  checkPrimitives<NeoPixelBrightnessBusGfx<NeoGrbFeature, Neo800KbpsMethod> >();
+
+  // bands count like drawing without them
+  for(uint8_t s = Plain; s <= BackBuffer; s++) {
+    for(uint8_t bands = 1; bands <= 4; bands++) {
+      NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> direct(W, H, 0);
+      NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> banded(W, H, 0);
+      setup(direct, (Setup) s);
+      setup(banded, (Setup) s);
+
+      scene(direct, 0, H);
+      banded.renderBands(&scene, bands);
+
+      uint32_t directSums[3], bandedSums[3];
+      direct.getPowerSums(directSums);
+      banded.getPowerSums(bandedSums);
+      NEOGFX_CHECK(memcmp(directSums, bandedSums, sizeof(directSums)) == 0);
+      NEOGFX_CHECK_EQUAL(banded.getPowerDemand(), direct.getPowerDemand());
+      NEOGFX_CHECK(sumsMatchRecount(banded));
+    }
+  }
+
+  return neoGfxTestResult("test_power");
+}
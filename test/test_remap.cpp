@@ -0,0 +1,101 @@
+// Remapping: the remap function, the remap table, a table in PROGMEM and
+// the compile time layouts have to give the same pixels.
+
+#include <type_traits>
+#include <NeoPixelBusGfx.h>
+#include "NeoGfxTest.h"
+
+static const int W = 6;
+static const int H = 5;
+
+// serpentine rows starting at the bottom right
+NeoGfxIndex serpentine(uint16_t x, uint16_t y) {
+  y = H - 1 - y;
+  x = W - 1 - x;
+  return y * W + (y & 1 ? W - 1 - x : x);
+}
+
+class SerpentineLayout {
+ public:
+  static NeoGfxIndex Map(uint16_t, uint16_t, uint16_t x, uint16_t y) {
+    return serpentine(x, y);
+  }
+};
+
+static NeoGfxIndex serpentineTable[W * H];
+
+typedef NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> Matrix;
+typedef NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod, SerpentineLayout> LayoutMatrix;
+
+// the remap table is owned by the matrix
+static_assert(!std::is_copy_constructible<Matrix>::value, "a copy would free the remap table twice");
+static_assert(!std::is_copy_assignable<Matrix>::value, "a copy would free the remap table twice");
+
+template<typename T_MATRIX>
+static void drawScene(T_MATRIX& matrix) {
+  matrix.fillScreen(0x0841);
+  matrix.drawLine(0, 0, matrix.width() - 1, matrix.height() - 1, 0xF800);
+  matrix.fillRect(1, 2, 3, 2, 0x07E0);
+  matrix.drawPixel(matrix.width() - 1, 0, 0x001F);
+  matrix.scroll(1, 0, 0xFFFF);
+  matrix.Show();
+}
+
+int main() {
+  for(uint16_t y = 0; y < H; y++) {
+    for(uint16_t x = 0; x < W; x++) {
+      serpentineTable[y * W + x] = serpentine(x, y);
+    }
+  }
+
+  // every position lands on the index of the remap function
+  {
+    Matrix matrix(W, H, 0);
+    matrix.setRemapFunction(&serpentine);
+    for(uint16_t y = 0; y < H; y++) {
+      for(uint16_t x = 0; x < W; x++) {
+        matrix.clear();
+        matrix.drawPixel(x, y, 0xFFFF);
+        matrix.Show();
+        NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(serpentine(x, y), RgbColor(255)));
+      }
+    }
+  }
+
+  for(uint8_t rotation = 0; rotation < 4; rotation++) {
+    Matrix function(W, H, 1);
+    function.setRemapFunction(&serpentine);
+    function.setRotation(rotation);
+    drawScene(function);
+    const std::vector<uint8_t> expected = NeoMockMethod::lastFrame(1)->data;
+
+    Matrix table(W, H, 2);
+    table.setRemapFunction(&serpentine);
+    NEOGFX_CHECK(table.enableRemapTable());
+    table.setRotation(rotation);
+    drawScene(table);
+    NEOGFX_CHECK(NeoMockMethod::lastFrame(2)->data == expected);
+
+    Matrix progmem(W, H, 3);
+    progmem.setRemapTable_P(serpentineTable);
+    progmem.setRotation(rotation);
+    drawScene(progmem);
+    NEOGFX_CHECK(NeoMockMethod::lastFrame(3)->data == expected);
+
+    LayoutMatrix layout(W, H, 4);
+    layout.setRotation(rotation);
+    drawScene(layout);
+    NEOGFX_CHECK(NeoMockMethod::lastFrame(4)->data == expected);
+
+    // a table built before the rotation changed is rebuilt
+    Matrix rebuilt(W, H, 5);
+    rebuilt.setRemapFunction(&serpentine);
+    rebuilt.enableRemapTable();
+    rebuilt.setRotation((rotation + 1) & 3);
+    rebuilt.setRotation(rotation);
+    drawScene(rebuilt);
+    NEOGFX_CHECK(NeoMockMethod::lastFrame(5)->data == expected);
+  }
+
+  return neoGfxTestResult("test_remap");
+}
@@ -0,0 +1,115 @@
+// Rotation: every primitive has to end up on the pixel Adafruit_GFX's
+// rotation math gives, with and without the remap table.
+
+#include <NeoPixelBusGfx.h>
+#include "NeoGfxTest.h"
+
+static const int W = 7;
+static const int H = 4;
+
+NeoGfxIndex rowMajor(uint16_t x, uint16_t y) {
+  return y * W + x;
+}
+
+// The unrotated position of x/y like Adafruit_GFX::drawPixel computes it.
+static uint16_t rotatedIndex(int16_t x, int16_t y, uint8_t rotation) {
+  int16_t t;
+  switch(rotation) {
+  case 1:
+    t = x;
+    x = W - 1 - y;
+    y = t;
+    break;
+  case 2:
+    x = W - 1 - x;
+    y = H - 1 - y;
+    break;
+  case 3:
+    t = x;
+    x = y;
+    y = H - 1 - t;
+    break;
+  }
+  return rowMajor(x, y);
+}
+
+typedef NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> Matrix;
+
+static void testPixels(bool table) {
+  const RgbColor white(255, 255, 255);
+
+  for(uint8_t rotation = 0; rotation < 4; rotation++) {
+    Matrix matrix(W, H, 0);
+    matrix.setRemapFunction(&rowMajor);
+    if(table) matrix.enableRemapTable();
+    matrix.setRotation(rotation);
+
+    NEOGFX_CHECK_EQUAL(matrix.width(),  rotation & 1 ? H : W);
+    NEOGFX_CHECK_EQUAL(matrix.height(), rotation & 1 ? W : H);
+
+    for(int16_t y = 0; y < matrix.height(); y++) {
+      for(int16_t x = 0; x < matrix.width(); x++) {
+        matrix.clear();
+        matrix.drawPixel(x, y, 0xFFFF);
+        matrix.Show();
+
+        for(uint16_t i = 0; i < W * H; i++) {
+          bool lit = i == rotatedIndex(x, y, rotation);
+          NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(i, lit ? white : RgbColor(0)));
+        }
+      }
+    }
+
+    // pixels outside of the rotated size are clipped
+    matrix.clear();
+    matrix.Show();
+    matrix.drawPixel(matrix.width(), 0, 0xFFFF);
+    matrix.drawPixel(0, matrix.height(), 0xFFFF);
+    matrix.drawPixel(-1, -1, 0xFFFF);
+    NEOGFX_CHECK(!matrix.isDirty());
+  }
+}
+
+// The span paths (fillRect, lines) have to match drawing pixel by pixel.
+static void testSpans(bool table) {
+  for(uint8_t rotation = 0; rotation < 4; rotation++) {
+    Matrix spans(W, H, 1);
+    Matrix pixels(W, H, 2);
+    spans.setRemapFunction(&rowMajor);
+    pixels.setRemapFunction(&rowMajor);
+    if(table) spans.enableRemapTable();
+    spans.setRotation(rotation);
+    pixels.setRotation(rotation);
+
+    spans.fillRect(1, 1, 3, 2, 0xF800);
+    spans.drawFastHLine(-2, 0, 5, 0x07E0);
+    spans.drawFastVLine(spans.width() - 1, 1, 10, 0x001F);
+    spans.drawRect(0, 0, spans.width(), spans.height(), 0xFFE0);
+
+    for(int16_t y = 1; y < 3; y++) {
+      for(int16_t x = 1; x < 4; x++) pixels.drawPixel(x, y, 0xF800);
+    }
+    for(int16_t x = 0; x < 3; x++) pixels.drawPixel(x, 0, 0x07E0);
+    for(int16_t y = 1; y < pixels.height(); y++) pixels.drawPixel(pixels.width() - 1, y, 0x001F);
+    for(int16_t x = 0; x < pixels.width(); x++) {
+      pixels.drawPixel(x, 0, 0xFFE0);
+      pixels.drawPixel(x, pixels.height() - 1, 0xFFE0);
+    }
+    for(int16_t y = 0; y < pixels.height(); y++) {
+      pixels.drawPixel(0, y, 0xFFE0);
+      pixels.drawPixel(pixels.width() - 1, y, 0xFFE0);
+    }
+
+    spans.Show();
+    pixels.Show();
+    NEOGFX_CHECK(NeoMockMethod::lastFrame(1)->data == NeoMockMethod::lastFrame(2)->data);
+  }
+}
+
+int main() {
+  testPixels(false);
+  testPixels(true);
+  testSpans(false);
+  testSpans(true);
+  return neoGfxTestResult("test_rotation");
+}
@@ -0,0 +1,123 @@
+// scroll(): in every rotation, with the remap function, the remap table, a
+// compile time layout, the back buffer and indexed colors, the frame equals
+// redrawing the shifted frame on a matrix which was not scrolled. The remap
+// function is called once per pixel.
+
+#include <NeoPixelBusGfx.h>
+#include "NeoGfxTest.h"
+
+static const int W = 7;
+static const int H = 5;
+
+static uint32_t remapCalls;
+
+NeoGfxIndex serpentine(uint16_t x, uint16_t y) {
+  remapCalls++;
+  return y * W + (y & 1 ? W - 1 - x : x);
+}
+
+class RowMajorLayout {
+ public:
+  static NeoGfxIndex Map(uint16_t width, uint16_t, uint16_t x, uint16_t y) {
+    return y * width + x;
+  }
+};
+
+typedef NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> Matrix;
+typedef NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod, RowMajorLayout> LayoutMatrix;
+
+enum Setup { RemapFunction, RemapTable, BackBuffer, Indexed8, Indexed4, Layout };
+static const char* setupNames[] = { "remap function", "remap table", "back buffer", "indexed 8", "indexed 4", "layout" };
+
+static const uint16_t FILL = 0x0841;
+
+// The color (or palette index) of a pixel of the frame before scrolling.
+static uint16_t value(Setup s, int16_t x, int16_t y) {
+  if(s == Indexed4) return (x + 3 * y) % 14 + 2;
+  if(s == Indexed8) return (x + 9 * y) % 200 + 2;
+  return (x * 31 + y * 977 + 1) * 2659;
+}
+
+template<typename T_MATRIX>
+static void setup(T_MATRIX& matrix, Setup s, uint8_t rotation) {
+  if(s != Layout) matrix.setRemapFunction(&serpentine);
+  switch(s) {
+  case RemapTable: NEOGFX_CHECK(matrix.enableRemapTable()); break;
+  case BackBuffer: NEOGFX_CHECK(matrix.enableBackBuffer()); break;
+  case Indexed8:   NEOGFX_CHECK(matrix.enableIndexedColor(8)); break;
+  case Indexed4:   NEOGFX_CHECK(matrix.enableIndexedColor(4)); break;
+  default: break;
+  }
+  if(s == Indexed8 || s == Indexed4) {
+    for(uint16_t i = 0; i < (s == Indexed4 ? 16 : 256); i++) {
+      matrix.setPaletteColor(i, RgbColor(i, 255 - i, i * 7));
+    }
+  }
+  matrix.setRotation(rotation);
+}
+
+// The frame shifted by dx, dy drawn pixel by pixel, or the frame before
+// scrolling for dx = dy = 0.
+template<typename T_MATRIX>
+static void draw(T_MATRIX& matrix, Setup s, int16_t dx, int16_t dy) {
+  for(int16_t y = 0; y < matrix.height(); y++) {
+    for(int16_t x = 0; x < matrix.width(); x++) {
+      int16_t sx = x - dx, sy = y - dy;
+      bool inside = sx >= 0 && sy >= 0 && sx < matrix.width() && sy < matrix.height();
+      matrix.drawPixel(x, y, inside ? value(s, sx, sy) : FILL);
+    }
+  }
+}
+
+template<typename T_MATRIX>
+static void checkScroll(Setup s, uint8_t rotation, int16_t dx, int16_t dy) {
+  T_MATRIX scrolled(W, H, 1);
+  T_MATRIX reference(W, H, 2);
+  setup(scrolled, s, rotation);
+  setup(reference, s, rotation);
+
+  draw(scrolled, s, 0, 0);
+  remapCalls = 0;
+  scrolled.scroll(dx, dy, FILL);
+  uint32_t calls = remapCalls;
+  draw(reference, s, dx, dy);
+
+  scrolled.Show();
+  reference.Show();
+  if(NeoMockMethod::lastFrame(1)->data != NeoMockMethod::lastFrame(2)->data) {
+    printf("%s, rotation %u, scroll(%d, %d)\n", setupNames[s], rotation, dx, dy);
+    NEOGFX_CHECK(!"scrolled frame differs from the redrawn one");
+  }
+
+  // every pixel is mapped once to be moved and once more if it is filled
+  if(s == RemapFunction) {
+    int16_t w = scrolled.width(), h = scrolled.height();
+    int16_t adx = abs(dx), ady = abs(dy);
+    uint32_t expected = adx >= w || ady >= h ? w * h : w * h + adx * h + (w - adx) * ady;
+    if(calls != expected) {
+      printf("rotation %u, scroll(%d, %d): %u remap calls instead of %u\n", rotation, dx, dy, (unsigned) calls, (unsigned) expected);
+      NEOGFX_CHECK(!"wrong number of remap calls");
+    }
+  }
+}
+
+int main() {
+  static const int16_t shifts[][2] = {
+    { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 }, { 2, 3 }, { -3, 2 }, { 3, -1 }, { -2, -2 },
+    { 6, 0 }, { 0, -4 }, { 7, 0 }, { 0, -7 }, { 9, 9 }
+  };
+
+  for(uint8_t s = RemapFunction; s <= Layout; s++) {
+    for(uint8_t rotation = 0; rotation < 4; rotation++) {
+      for(uint8_t i = 0; i < sizeof(shifts) / sizeof(shifts[0]); i++) {
+        if(s == Layout) {
+          checkScroll<LayoutMatrix>((Setup) s, rotation, shifts[i][0], shifts[i][1]);
+        } else {
+          checkScroll<Matrix>((Setup) s, rotation, shifts[i][0], shifts[i][1]);
+        }
+      }
+    }
+  }
+
+  return neoGfxTestResult("test_scroll");
+}
@@ -0,0 +1,76 @@
+// Show() with a back buffer: the power limit, the output table and sprites
+// enable it, Show() then presents the frame drawn instead of the pixels
+// the bus had before.
+
+#include <NeoPixelBusGfx.h>
+#include <NeoPixelBrightnessBusGfx.h>
+#include <NeoPixelMultiBusGfx.h>
+#include "NeoGfxTest.h"
+
+static const int W = 4;
+static const int H = 4;
+
+NeoGfxIndex rowMajor(uint16_t x, uint16_t y) {
+  return y * W + x;
+}
+
+static const RgbColor white(255);
+static const RgbColor black(0);
+static const RgbColor spriteColor(10, 20, 30);
+static const RgbColor sprite[1] = { spriteColor };
+
+// Draws, shows and checks the wire, twice so the second frame is not the
+// first one left in the bus.
+template<typename T_MATRIX>
+static void drawAndShow(T_MATRIX& matrix, uint8_t pin = 0) {
+  matrix.setRemapFunction(&rowMajor);
+  matrix.drawPixel(1, 1, 0xFFFF);
+  matrix.Show();
+  NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(rowMajor(1, 1), white, pin));
+  NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(rowMajor(2, 2), black, pin));
+
+  matrix.fillScreen(0);
+  matrix.drawPixel(2, 2, 0xFFFF);
+  matrix.Show();
+  NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(rowMajor(1, 1), black, pin));
+  NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(rowMajor(2, 2), white, pin));
+}
+
+template<typename T_MATRIX>
+static void checkAll() {
+  {
+    T_MATRIX matrix(W, H, 0);
+    NEOGFX_CHECK(matrix.setPowerLimit(100000));
+    drawAndShow(matrix);
+  }
+  {
+    T_MATRIX matrix(W, H, 0);
+    NEOGFX_CHECK(matrix.enableOutputTable());
+    drawAndShow(matrix);
+  }
+  {
+    T_MATRIX matrix(W, H, 0);
+    NEOGFX_CHECK(matrix.addSprite(sprite, 1, 1, 3, 0) >= 0);
+    drawAndShow(matrix);
+    NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(rowMajor(3, 0), spriteColor));
+  }
+}
+
+int main() {
+  checkAll<NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> >();
+  checkAll<NeoPixelBrightnessBusGfx<NeoGrbFeature, Neo800KbpsMethod> >();
+
+  // on all buses, with the limit shared
+  {
+    const uint8_t pins[2] = { 1, 2 };
+    NeoPixelMultiBusGfx<NeoGrbFeature, Neo800KbpsMethod, 2> matrix(W, H * 2, pins);
+    NEOGFX_CHECK(matrix.setPowerLimit(100000));
+    drawAndShow(matrix, 1);
+
+    matrix.drawPixel(0, H, 0xFFFF);
+    matrix.Show();
+    NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(rowMajor(0, 0), white, 2));
+  }
+
+  return neoGfxTestResult("test_show");
+}
@@ -0,0 +1,82 @@
+// Matrix sizes: a matrix too big for the 16-bit pixel count of a bus, or
+// (without NEOGFX_LARGE_MATRIX, test_size_large is built with it) wider or
+// higher than 255 pixels gets no pixels instead of a truncated bus, and
+// drawing on it does nothing.
+
+#include <NeoPixelBusGfx.h>
+#include <NeoPixelBrightnessBusGfx.h>
+#include <NeoPixelMultiBusGfx.h>
+#include "NeoGfxTest.h"
+
+NeoGfxIndex rowMajor(uint16_t x, uint16_t y) {
+  return (NeoGfxIndex) y * 300 + x;
+}
+
+#ifdef NEOGFX_LARGE_MATRIX
+static const bool large = true;
+#else
+static const bool large = false;
+#endif
+
+template<typename T_MATRIX>
+static void draw(T_MATRIX& matrix) {
+  matrix.setRemapFunction(&rowMajor);
+  matrix.fillScreen(0xFFFF);
+  matrix.drawPixel(1, 1, 0xF800);
+  matrix.fillRect(0, 0, 20, 20, 0x07E0);
+  matrix.drawLine(0, 0, matrix.width() - 1, matrix.height() - 1, 0x001F);
+  matrix.Show();
+}
+
+template<typename T_MATRIX>
+static void checkSizes() {
+  // fits: 255 x 257 = 65535 pixels
+  {
+    T_MATRIX matrix(255, 257, 0);
+    NEOGFX_CHECK_EQUAL(matrix.PixelCount(), large ? 255 * 257 : 0);
+  }
+  {
+    T_MATRIX matrix(255, 255, 0);
+    NEOGFX_CHECK_EQUAL(matrix.PixelCount(), 255 * 255);
+  }
+
+  // a row of more than 255 pixels
+  {
+    T_MATRIX matrix(300, 10, 0);
+    NEOGFX_CHECK_EQUAL(matrix.PixelCount(), large ? 3000 : 0);
+    draw(matrix);
+    matrix.scroll(1, 1, 0);
+  }
+
+  // more than 65535 pixels
+  {
+    T_MATRIX matrix(256, 256, 0);
+    NEOGFX_CHECK_EQUAL(matrix.PixelCount(), 0);
+    draw(matrix);
+    matrix.scroll(1, 1, 0);
+  }
+  {
+    T_MATRIX matrix(0, 10, 0);
+    NEOGFX_CHECK_EQUAL(matrix.PixelCount(), 0);
+  }
+}
+
+int main() {
+  checkSizes<NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> >();
+  checkSizes<NeoPixelBrightnessBusGfx<NeoGrbFeature, Neo800KbpsMethod> >();
+
+  // the strips of several buses
+  {
+    const uint8_t pins[2] = { 1, 2 };
+    NeoPixelMultiBusGfx<NeoGrbFeature, Neo800KbpsMethod, 2> matrix(300, 20, pins);
+    NEOGFX_CHECK_EQUAL(matrix.Bus(0).PixelCount(), large ? 3000 : 0);
+    NEOGFX_CHECK_EQUAL(matrix.Bus(1).PixelCount(), large ? 3000 : 0);
+    draw(matrix);
+
+    NeoPixelMultiBusGfx<NeoGrbFeature, Neo800KbpsMethod, 2> tall(200, 700, pins);
+    NEOGFX_CHECK_EQUAL(tall.Bus(0).PixelCount(), 0);
+    NEOGFX_CHECK_EQUAL(tall.Bus(1).PixelCount(), 0);
+  }
+
+  return neoGfxTestResult(large ? "test_size_large" : "test_size");
+}
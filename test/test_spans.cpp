@@ -0,0 +1,90 @@
+// Span writes: runs of pixels next to each other on the bus are written
+// at once, the part of a run beyond the bus is dropped.
+
+#include <NeoPixelBusGfx.h>
+#include "NeoGfxTest.h"
+
+static const int W = 6;
+static const int H = 4;
+
+NeoGfxIndex rowMajor(uint16_t x, uint16_t y) {
+  return y * W + x;
+}
+
+// shifted by half a row, so the last row of the matrix is half beyond
+// the bus
+NeoGfxIndex shifted(uint16_t x, uint16_t y) {
+  return y * W + x + W / 2;
+}
+
+// columns in reverse order, so the runs go backwards on the bus
+NeoGfxIndex reversed(uint16_t x, uint16_t y) {
+  return y * W + W - 1 - x;
+}
+
+typedef NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> Matrix;
+
+int main() {
+  const RgbColor white(255);
+  const RgbColor black(0);
+
+  // a run which starts on the bus and ends beyond it
+  {
+    Matrix matrix(W, H, 0);
+    matrix.setRemapFunction(&shifted);
+    matrix.fillRect(0, 0, W, H, 0xFFFF);
+    matrix.Show();
+
+    for(uint16_t i = 0; i < W * H; i++) {
+      NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(i, i < W / 2 ? black : white));
+    }
+  }
+
+  {
+    Matrix matrix(W, H, 0);
+    matrix.setRemapFunction(&shifted);
+    matrix.fillRect(2, H - 2, 3, 2, 0xFFFF);
+    matrix.Show();
+
+    for(uint16_t i = 0; i < W * H; i++) {
+      bool lit = false;
+      for(uint16_t y = H - 2; y < H; y++) {
+        for(uint16_t x = 2; x < 5; x++) lit |= shifted(x, y) == i;
+      }
+      NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(i, lit ? white : black));
+    }
+  }
+
+  // runs in both directions match drawing pixel by pixel
+  for(int mode = 0; mode < 2; mode++) {
+    Matrix spans(W, H, 1);
+    Matrix pixels(W, H, 2);
+    spans.setRemapFunction(mode ? &reversed : &rowMajor);
+    pixels.setRemapFunction(mode ? &reversed : &rowMajor);
+
+    spans.fillRect(1, 0, 4, 3, 0xF800);
+    spans.drawFastHLine(0, 3, W, 0x07E0);
+    spans.drawFastVLine(5, 0, H, 0x001F);
+    for(int16_t y = 0; y < 3; y++) {
+      for(int16_t x = 1; x < 5; x++) pixels.drawPixel(x, y, 0xF800);
+    }
+    for(int16_t x = 0; x < W; x++) pixels.drawPixel(x, 3, 0x07E0);
+    for(int16_t y = 0; y < H; y++) pixels.drawPixel(5, y, 0x001F);
+
+    spans.Show();
+    pixels.Show();
+    NEOGFX_CHECK(NeoMockMethod::lastFrame(1)->data == NeoMockMethod::lastFrame(2)->data);
+  }
+
+  // a span which changes nothing leaves the matrix clean
+  {
+    Matrix matrix(W, H, 0);
+    matrix.setRemapFunction(&rowMajor);
+    matrix.fillRect(0, 0, 3, 3, 0xFFFF);
+    matrix.Show();
+    matrix.fillRect(0, 0, 3, 3, 0xFFFF);
+    NEOGFX_CHECK(!matrix.isDirty());
+  }
+
+  return neoGfxTestResult("test_spans");
+}
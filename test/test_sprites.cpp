@@ -0,0 +1,186 @@
+// Sprites: present() blends them over the back buffer. Moving or hiding
+// one brings back the background below it, higher z is on top, pixels
+// with the color key are left out, alpha blends the bytes, and sprites
+// are placed in the coordinates of the current rotation. The expected
+// frames are drawn directly on a matrix without sprites.
+
+#include <NeoPixelBusGfx.h>
+#include "NeoGfxTest.h"
+
+static const int W = 8;
+static const int H = 6;
+
+NeoGfxIndex serpentine(uint16_t x, uint16_t y) {
+  return y * W + (y & 1 ? W - 1 - x : x);
+}
+
+typedef NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> Matrix;
+
+static const RgbColor red(200, 0, 0);
+static const RgbColor blue(0, 0, 200);
+static const RgbColor key(1, 2, 3);
+
+static const RgbColor redSprite[2 * 2]  = { red, red, red, red };
+static const RgbColor blueSprite[3 * 2] = { blue, blue, blue, blue, blue, blue };
+// a corner with the color key
+static const RgbColor keyedSprite[2 * 2] = { key, blue, blue, blue };
+
+static void background(Matrix& matrix) {
+  matrix.fillScreen(0x0841);
+  matrix.drawLine(0, 0, matrix.width() - 1, matrix.height() - 1, 0x07E0);
+  matrix.fillRect(2, 3, 3, 2, 0xF81F);
+}
+
+static Matrix* newMatrix(uint8_t pin, uint8_t rotation = 0) {
+  Matrix* matrix = new Matrix(W, H, pin);
+  matrix->setRemapFunction(&serpentine);
+  matrix->setRotation(rotation);
+  background(*matrix);
+  return matrix;
+}
+
+// The frame of matrix (with sprites) equals the one of reference.
+static bool sameFrame(Matrix& matrix, Matrix& reference) {
+  while(!matrix.present());
+  reference.Show();
+  return NeoMockMethod::lastFrame(1)->data == NeoMockMethod::lastFrame(2)->data;
+}
+
+// a over b with alpha, as present() blends the bytes
+static uint8_t blend(uint8_t b, uint8_t a, uint8_t alpha) {
+  return b + (((int32_t)a - b) * (alpha + 1) >> 8);
+}
+
+int main() {
+  // moving and hiding restore the background
+  {
+    Matrix* matrix = newMatrix(1);
+    int8_t id = matrix->addSprite(redSprite, 2, 2, 1, 1);
+    NEOGFX_CHECK(id >= 0);
+
+    Matrix* reference = newMatrix(2);
+    reference->drawNativeBitmap(1, 1, redSprite, 2, 2);
+    NEOGFX_CHECK(sameFrame(*matrix, *reference));
+
+    matrix->moveSprite(id, 5, 3);
+    delete reference;
+    reference = newMatrix(2);
+    reference->drawNativeBitmap(5, 3, redSprite, 2, 2);
+    NEOGFX_CHECK(sameFrame(*matrix, *reference));
+
+    // partly outside of the matrix
+    matrix->moveSprite(id, 7, -1);
+    delete reference;
+    reference = newMatrix(2);
+    reference->drawPixel(7, 0, red);
+    NEOGFX_CHECK(sameFrame(*matrix, *reference));
+
+    matrix->setSpriteVisible(id, false);
+    delete reference;
+    reference = newMatrix(2);
+    NEOGFX_CHECK(sameFrame(*matrix, *reference));
+
+    matrix->setSpriteVisible(id, true);
+    matrix->removeSprite(id);
+    NEOGFX_CHECK(sameFrame(*matrix, *reference));
+
+    // drawing below a sprite keeps the sprite on top
+    id = matrix->addSprite(redSprite, 2, 2, 0, 0);
+    matrix->fillRect(0, 0, 4, 4, 0xFFFF);
+    reference->fillRect(0, 0, 4, 4, 0xFFFF);
+    reference->drawNativeBitmap(0, 0, redSprite, 2, 2);
+    NEOGFX_CHECK(sameFrame(*matrix, *reference));
+
+    delete matrix;
+    delete reference;
+  }
+
+  // z-order of overlapping sprites
+  {
+    Matrix* matrix = newMatrix(1);
+    int8_t r = matrix->addSprite(redSprite, 2, 2, 2, 1, 1);
+    int8_t b = matrix->addSprite(blueSprite, 3, 2, 3, 2, 0);
+
+    Matrix* reference = newMatrix(2);
+    reference->drawNativeBitmap(3, 2, blueSprite, 3, 2);
+    reference->drawNativeBitmap(2, 1, redSprite, 2, 2);
+    NEOGFX_CHECK(sameFrame(*matrix, *reference));
+
+    matrix->setSpriteZ(b, 2);
+    reference->drawNativeBitmap(3, 2, blueSprite, 3, 2);
+    NEOGFX_CHECK(sameFrame(*matrix, *reference));
+
+    // the same z: the order of the ids
+    matrix->setSpriteZ(r, 2);
+    reference->drawNativeBitmap(3, 2, blueSprite, 3, 2);
+    NEOGFX_CHECK(sameFrame(*matrix, *reference));
+
+    delete matrix;
+    delete reference;
+  }
+
+  // color key and alpha
+  {
+    Matrix* matrix = newMatrix(1);
+    int8_t id = matrix->addSprite(keyedSprite, 2, 2, 0, 0);
+    matrix->setSpriteColorKey(id, key);
+
+    Matrix* reference = newMatrix(2);
+    reference->drawNativeBitmap(0, 0, keyedSprite, 2, 2);
+    reference->drawPixel(0, 0, 0x07E0);  // the background of the keyed pixel
+    NEOGFX_CHECK(sameFrame(*matrix, *reference));
+
+    matrix->clearSpriteColorKey(id);
+    reference->drawPixel(0, 0, key);
+    NEOGFX_CHECK(sameFrame(*matrix, *reference));
+
+    // half transparent over the background
+    matrix->setSpriteColorKey(id, key);
+    matrix->moveSprite(id, 3, 3);
+    matrix->setSpriteAlpha(id, 128);
+    delete reference;
+    reference = newMatrix(2);
+    for(int16_t j = 0; j < 2; j++) {
+      for(int16_t i = 0; i < 2; i++) {
+        RgbColor below = reference->GetPixelColor(serpentine(3 + i, 3 + j));
+        RgbColor top = keyedSprite[j * 2 + i];
+        if(top == key) continue;
+        reference->drawPixel(3 + i, 3 + j, RgbColor(blend(below.R, top.R, 128), blend(below.G, top.G, 128), blend(below.B, top.B, 128)));
+      }
+    }
+    NEOGFX_CHECK(sameFrame(*matrix, *reference));
+
+    // alpha 0 hides the sprite
+    matrix->setSpriteAlpha(id, 0);
+    delete reference;
+    reference = newMatrix(2);
+    NEOGFX_CHECK(sameFrame(*matrix, *reference));
+
+    delete matrix;
+    delete reference;
+  }
+
+  // in the coordinates of the current rotation
+  for(uint8_t rotation = 0; rotation < 4; rotation++) {
+    Matrix* matrix = newMatrix(1, rotation);
+    int8_t id = matrix->addSprite(blueSprite, 3, 2, 1, 2);
+    matrix->addSprite(redSprite, 2, 2, matrix->width() - 2, 0, 1);
+
+    Matrix* reference = newMatrix(2, rotation);
+    reference->drawNativeBitmap(1, 2, blueSprite, 3, 2);
+    reference->drawNativeBitmap(reference->width() - 2, 0, redSprite, 2, 2);
+    NEOGFX_CHECK(sameFrame(*matrix, *reference));
+
+    matrix->moveSprite(id, 0, matrix->height() - 2);
+    delete reference;
+    reference = newMatrix(2, rotation);
+    reference->drawNativeBitmap(0, reference->height() - 2, blueSprite, 3, 2);
+    reference->drawNativeBitmap(reference->width() - 2, 0, redSprite, 2, 2);
+    NEOGFX_CHECK(sameFrame(*matrix, *reference));
+
+    delete matrix;
+    delete reference;
+  }
+
+  return neoGfxTestResult("test_sprites");
+}
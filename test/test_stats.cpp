@@ -0,0 +1,110 @@
+// Profiling counters (built with NEOGFX_STATS): a known sequence of draws
+// gives the expected counts, remaps are counted except for the remap table,
+// Show() counts frames and calls the frame callback, and the drawing time
+// runs from the outermost startWrite() to its endWrite().
+
+#include <NeoPixelBusGfx.h>
+#include <NeoPixelBrightnessBusGfx.h>
+#include "NeoGfxTest.h"
+
+static const int W = 8;
+static const int H = 5;
+
+static uint32_t remapCalls;
+
+NeoGfxIndex serpentine(uint16_t x, uint16_t y) {
+  remapCalls++;
+  return y * W + (y & 1 ? W - 1 - x : x);
+}
+
+static uint32_t callbackFrames;
+
+static void onFrame(const NeoGfxStats& stats) {
+  callbackFrames = stats.frames;
+}
+
+template<typename T_MATRIX>
+static void checkStats() {
+  neoShimSetMicros(0);
+  T_MATRIX matrix(W, H, 0);
+  matrix.setRemapFunction(&serpentine);
+  matrix.resetStats();
+  remapCalls = 0;
+
+  const NeoGfxStats& stats = matrix.getStats();
+
+  // pixels: one conversion per color, those outside are clipped
+  matrix.drawPixel(1, 1, 0xF800);
+  matrix.drawPixel(2, 1, 0xF800);
+  matrix.drawPixel(-1, 0, 0xF800);
+  matrix.drawPixel(0, H, 0x07E0);
+  NEOGFX_CHECK_EQUAL(stats.drawPixelCalls, 4);
+  NEOGFX_CHECK_EQUAL(stats.clippedPixels, 2);
+  NEOGFX_CHECK_EQUAL(stats.colorConversions, 2);
+  NEOGFX_CHECK_EQUAL(stats.remapCalls, 2);
+  NEOGFX_CHECK_EQUAL(stats.remapCalls, remapCalls);
+  NEOGFX_CHECK_EQUAL(stats.spanWrites, 0);
+
+  // rects: the part outside is clipped, a serpentine row is one span
+  matrix.fillRect(-2, -1, 4, 3, 0x07E0);
+  NEOGFX_CHECK_EQUAL(stats.clippedPixels, 2 + 12 - 4);
+  NEOGFX_CHECK_EQUAL(stats.colorConversions, 2);
+  NEOGFX_CHECK_EQUAL(stats.spanWrites, 2);
+  matrix.drawFastHLine(0, 4, W, 0x07E0);
+  NEOGFX_CHECK_EQUAL(stats.spanWrites, 3);
+  matrix.fillRect(W, 0, 2, 2, 0x07E0);
+  NEOGFX_CHECK_EQUAL(stats.clippedPixels, 2 + 12 - 4 + 4);
+  NEOGFX_CHECK_EQUAL(stats.spanWrites, 3);
+  NEOGFX_CHECK_EQUAL(stats.drawPixelCalls, 4);
+  NEOGFX_CHECK_EQUAL(stats.remapCalls, remapCalls);
+
+  // the remap table maps every pixel once, drawing then doesn't remap
+  NEOGFX_CHECK(matrix.enableRemapTable());
+  NEOGFX_CHECK_EQUAL(stats.remapCalls, remapCalls);
+  uint32_t remaps = stats.remapCalls;
+  matrix.drawPixel(3, 3, 0x001F);
+  matrix.fillRect(0, 0, W, H, 0x001F);
+  NEOGFX_CHECK_EQUAL(stats.remapCalls, remaps);
+  NEOGFX_CHECK_EQUAL(remapCalls, remaps);
+
+  // frames and the callback
+  callbackFrames = 0;
+  matrix.setFrameCallback(&onFrame);
+  matrix.Show();
+  matrix.Show();
+  NEOGFX_CHECK_EQUAL(stats.frames, 2);
+  NEOGFX_CHECK_EQUAL(callbackFrames, 2);
+
+  // the drawing time: nested scopes (Adafruit_GFX's drawLine calls
+  // startWrite itself) are counted once, through the virtual startWrite
+  Adafruit_GFX& gfx = matrix;
+  NEOGFX_CHECK_EQUAL(stats.drawMicros, 0);
+  neoShimSetMicros(1000);
+  gfx.startWrite();
+  neoShimSetMicros(1200);
+  gfx.drawLine(0, 0, W - 1, H - 1, 0xFFFF);
+  matrix.drawPixel(0, 0, 0xFFFF);
+  neoShimSetMicros(1500);
+  gfx.endWrite();
+  NEOGFX_CHECK_EQUAL(stats.drawMicros, 500);
+
+  neoShimSetMicros(2000);
+  gfx.endWrite();
+  NEOGFX_CHECK_EQUAL(stats.drawMicros, 500);
+
+  matrix.resetStats();
+  NEOGFX_CHECK_EQUAL(stats.drawPixelCalls, 0);
+  NEOGFX_CHECK_EQUAL(stats.clippedPixels, 0);
+  NEOGFX_CHECK_EQUAL(stats.remapCalls, 0);
+  NEOGFX_CHECK_EQUAL(stats.colorConversions, 0);
+  NEOGFX_CHECK_EQUAL(stats.spanWrites, 0);
+  NEOGFX_CHECK_EQUAL(stats.drawMicros, 0);
+  NEOGFX_CHECK_EQUAL(stats.frames, 0);
+}
+
+int main() {
+  checkStats<NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> >();
+  checkStats<NeoPixelBrightnessBusGfx<NeoGrbFeature, Neo800KbpsMethod> >();
+
+  return neoGfxTestResult("test_stats");
+}
@@ -0,0 +1,161 @@
+// Frame streams: packets split at any byte give the same pixels, invalid
+// headers are skipped, pixels beyond the bus are dropped and the end of a
+// frame is reported when its packet is complete.
+
+#include <vector>
+#include <NeoPixelBusGfx.h>
+#include "NeoGfxTest.h"
+
+static const int W = 4;
+static const int H = 3;
+
+// rows in reverse order
+NeoGfxIndex reversedRows(uint16_t x, uint16_t y) {
+  return (H - 1 - y) * W + x;
+}
+
+typedef NeoPixelBusGfx<NeoGrbFeature, Neo800KbpsMethod> Matrix;
+typedef std::vector<uint8_t> Bytes;
+
+static void addPacket(Bytes& stream, uint8_t flags, uint8_t channels, uint16_t offset, uint16_t count, uint8_t seed) {
+  const uint8_t header[] = { 'N', 'G', flags, channels, (uint8_t) offset, (uint8_t)(offset >> 8), (uint8_t) count, (uint8_t)(count >> 8) };
+  stream.insert(stream.end(), header, header + sizeof(header));
+  for(uint16_t i = 0; i < count * channels; i++) {
+    stream.push_back((uint8_t)(seed + i * 37));
+  }
+}
+
+// Feeds stream in chunks of size bytes, returns the number of ends of
+// frames reported.
+static int feed(Matrix& matrix, const Bytes& stream, size_t size) {
+  int frames = 0;
+  for(size_t i = 0; i < stream.size(); i += size) {
+    size_t n = stream.size() - i < size ? stream.size() - i : size;
+    if(matrix.feedStream(&stream[i], n)) frames++;
+  }
+  return frames;
+}
+
+static Bytes frameOf(Matrix& matrix, uint8_t pin) {
+  matrix.Show();
+  return NeoMockMethod::lastFrame(pin)->data;
+}
+
+int main() {
+  // every chunk size gives the pixels of feeding the stream at once
+  {
+    Bytes stream;
+    addPacket(stream, 0, 3, 0, 5, 1);
+    addPacket(stream, NeoGfxStreamRemap, 2, 3, 6, 2);
+    addPacket(stream, NeoGfxStreamWireOrder, 3, 7, 4, 3);
+    addPacket(stream, NeoGfxStreamRemap | NeoGfxStreamEndOfFrame, 3, 10, 2, 4);
+
+    Matrix whole(W, H, 1);
+    whole.setRemapFunction(&reversedRows);
+    NEOGFX_CHECK_EQUAL(feed(whole, stream, stream.size()), 1);
+    Bytes expected = frameOf(whole, 1);
+
+    for(size_t size = 1; size < stream.size(); size++) {
+      Matrix chunked(W, H, 2);
+      chunked.setRemapFunction(&reversedRows);
+      NEOGFX_CHECK_EQUAL(feed(chunked, stream, size), 1);
+      NEOGFX_CHECK(frameOf(chunked, 2) == expected);
+    }
+  }
+
+  // the pixels end up where the header says
+  {
+    Bytes stream;
+    addPacket(stream, 0, 3, 2, 1, 0);
+    stream[8] = 10; stream[9] = 20; stream[10] = 30;
+    addPacket(stream, NeoGfxStreamRemap, 3, W, 1, 0);
+    stream[19] = 40; stream[20] = 50; stream[21] = 60;
+
+    Matrix matrix(W, H, 0);
+    matrix.setRemapFunction(&reversedRows);
+    feed(matrix, stream, stream.size());
+    matrix.Show();
+    NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(2, RgbColor(10, 20, 30)));
+    NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(reversedRows(0, 1), RgbColor(40, 50, 60)));
+  }
+
+  // garbage and invalid headers are skipped up to the next 'N' 'G'
+  {
+    Bytes good;
+    addPacket(good, NeoGfxStreamEndOfFrame, 3, 0, W * H, 5);
+
+    Bytes stream;
+    const uint8_t garbage[] = { 'x', 'N', 'N', 'y', 'G', 'N', 'G', 0, 7, 0, 0, 1, 0 };
+    stream.insert(stream.end(), garbage, garbage + sizeof(garbage));
+    addPacket(stream, NeoGfxStreamWireOrder, 4, 0, 1, 6);
+    stream.push_back('N');
+    stream.insert(stream.end(), good.begin(), good.end());
+
+    Matrix reference(W, H, 1);
+    reference.setRemapFunction(&reversedRows);
+    NEOGFX_CHECK_EQUAL(feed(reference, good, good.size()), 1);
+    Bytes expected = frameOf(reference, 1);
+
+    for(size_t size = 1; size <= stream.size(); size += 5) {
+      Matrix matrix(W, H, 2);
+      matrix.setRemapFunction(&reversedRows);
+      NEOGFX_CHECK_EQUAL(feed(matrix, stream, size), 1);
+      NEOGFX_CHECK(frameOf(matrix, 2) == expected);
+    }
+  }
+
+  // offsets and counts past the end drop the pixels beyond, the packet is
+  // still consumed as a whole
+  {
+    Bytes stream;
+    addPacket(stream, 0, 3, W * H - 2, 5, 7);
+    addPacket(stream, NeoGfxStreamWireOrder, 3, W * H - 1, 3, 8);
+    addPacket(stream, NeoGfxStreamRemap, 2, W * H - 1, 4, 9);
+    addPacket(stream, 0, 3, 1000, 2, 10);
+    addPacket(stream, NeoGfxStreamEndOfFrame, 3, 0, 1, 0);
+    stream[stream.size() - 3] = 1; stream[stream.size() - 2] = 2; stream[stream.size() - 1] = 3;
+
+    for(size_t size = 1; size <= stream.size(); size += 3) {
+      Matrix matrix(W, H, 0);
+      matrix.setRemapFunction(&reversedRows);
+      NEOGFX_CHECK_EQUAL(feed(matrix, stream, size), 1);
+      matrix.Show();
+      NEOGFX_CHECK(neoGfxWireIs<NeoGrbFeature>(0, RgbColor(1, 2, 3)));
+      NEOGFX_CHECK_EQUAL(NeoMockMethod::lastFrame(0)->data.size(), W * H * 3);
+    }
+  }
+
+  // the end of a frame is reported by the chunk completing its packet
+  {
+    Bytes first, second;
+    addPacket(first, NeoGfxStreamEndOfFrame, 3, 0, 2, 11);
+    addPacket(second, NeoGfxStreamEndOfFrame, 3, 2, 2, 12);
+
+    Matrix matrix(W, H, 0);
+    NEOGFX_CHECK(!matrix.feedStream(&first[0], first.size() - 1));
+    NEOGFX_CHECK(matrix.feedStream(&first[first.size() - 1], 1));
+
+    // the end of one packet and the start of the next in one chunk
+    Bytes both(first.begin(), first.end());
+    both.insert(both.end(), second.begin(), second.begin() + 10);
+    NEOGFX_CHECK(matrix.feedStream(&both[0], both.size()));
+    NEOGFX_CHECK(matrix.feedStream(&second[10], second.size() - 10));
+
+    // a packet without pixels
+    Bytes empty;
+    addPacket(empty, NeoGfxStreamEndOfFrame, 2, 0, 0, 0);
+    NEOGFX_CHECK(matrix.feedStream(&empty[0], empty.size()));
+
+    // without the flag nothing is reported
+    Bytes plain;
+    addPacket(plain, 0, 3, 0, 2, 13);
+    NEOGFX_CHECK(!matrix.feedStream(&plain[0], plain.size()));
+
+    // resetStream drops a partial packet
+    NEOGFX_CHECK(!matrix.feedStream(&first[0], 5));
+    matrix.resetStream();
+    NEOGFX_CHECK(matrix.feedStream(&second[0], second.size()));
+  }
+
+  return neoGfxTestResult("test_stream");
+}
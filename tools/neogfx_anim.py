@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+"""Encodes 16-bit (565) frames into the animation format of NeoGfxAnimation.h.
+
+The frames are read from C headers with arrays of 565 colors (like the
+bitmaps of the MatrixGFXDemo example), every array is one frame:
+
+    tools/neogfx_anim.py -W 24 -H 24 --delay 200 -n smileys \\
+        heart24.h yellowsmiley24.h bluesmiley24.h > smileys.h
+
+The output is a C header with the animation as PROGMEM array, or the raw
+animation (e.g. for a file system) with --binary.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+VERSION = 1
+FLAG_KEYFRAME = 0x01
+
+MAX_SKIP = 0x40
+MAX_REPEAT = 0x40
+MAX_LITERAL = 0x80
+
+ARRAY = re.compile(r"\{([^}]*)\}", re.S)
+NUMBER = re.compile(r"0x[0-9a-fA-F]+|\b\d+\b")
+COMMENT = re.compile(r"//[^\n]*|/\*.*?\*/", re.S)
+
+
+def read_frames(path, size):
+    with open(path) as f:
+        text = COMMENT.sub("", f.read())
+
+    frames = []
+    for array in ARRAY.findall(text):
+        colors = [int(n, 0) & 0xFFFF for n in NUMBER.findall(array)]
+        if len(colors) != size:
+            sys.exit("%s: array with %d colors, expected %d" % (path, len(colors), size))
+        frames.append(colors)
+    if not frames:
+        sys.exit("%s: no array found" % path)
+    return frames
+
+
+def encode_color(color, palette):
+    if palette is None:
+        return struct.pack("<H", color)
+    return struct.pack("<B", palette[color])
+
+
+def encode_changes(frame, previous, palette):
+    """Commands drawing frame over previous (all pixels if previous is None)."""
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            part = literal[:MAX_LITERAL]
+            del literal[:MAX_LITERAL]
+            out.append(0x80 | (len(part) - 1))
+            for color in part:
+                out.extend(encode_color(color, palette))
+
+    # the pixels after the last change don't need skips
+    count = len(frame)
+    if previous is not None:
+        while count > 0 and frame[count - 1] == previous[count - 1]:
+            count -= 1
+
+    i = 0
+    while i < count:
+        if previous is not None and frame[i] == previous[i]:
+            flush_literal()
+            n = 1
+            while i + n < count and n < MAX_SKIP and frame[i + n] == previous[i + n]:
+                n += 1
+            out.append(n - 1)
+            i += n
+            continue
+
+        n = 1
+        while i + n < count and n < MAX_REPEAT and frame[i + n] == frame[i]:
+            n += 1
+        if n >= 3:
+            flush_literal()
+            out.append(0x40 | (n - 1))
+            out += encode_color(frame[i], palette)
+            i += n
+        else:
+            literal.append(frame[i])
+            i += 1
+    flush_literal()
+    return out
+
+
+def encode(frames, width, height, delay, keyframe_interval):
+    colors = sorted(set(c for frame in frames for c in frame))
+    palette = {c: i for i, c in enumerate(colors)} if len(colors) <= 256 else None
+
+    out = bytearray(b"NA")
+    out += struct.pack("<BHHHH", VERSION, width, height, len(frames), len(colors) if palette else 0)
+    if palette:
+        for c in colors:
+            out += struct.pack("<H", c)
+
+    previous = None
+    for n, frame in enumerate(frames):
+        key = previous is None or (keyframe_interval and n % keyframe_interval == 0)
+        commands = encode_changes(frame, None if key else previous, palette)
+        if len(commands) > 0xFFFF:
+            sys.exit("frame %d is too big" % n)
+
+        out += struct.pack("<BHH", FLAG_KEYFRAME if key else 0, delay, len(commands))
+        out += commands
+        previous = frame
+    return out
+
+
+def c_header(data, name, width, height, frames, inputs):
+    lines = [
+        "// Generated by tools/neogfx_anim.py from " + " ".join(os.path.basename(path) for path in inputs),
+        "// %d frames of %dx%d pixels, %d bytes" % (frames, width, height, len(data)),
+        "",
+        "const uint8_t %s[] PROGMEM = {" % name,
+    ]
+    for i in range(0, len(data), 16):
+        lines.append("  " + " ".join("0x%02X," % b for b in data[i:i + 16]))
+    lines.append("};")
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("inputs", nargs="+", help="C headers with arrays of 565 colors")
+    parser.add_argument("-W", "--width", type=int, required=True)
+    parser.add_argument("-H", "--height", type=int, required=True)
+    parser.add_argument("-d", "--delay", type=int, default=100, help="ms per frame")
+    parser.add_argument("-k", "--keyframe-interval", type=int, default=0,
+                        help="every n-th frame is a keyframe (0: only the first)")
+    parser.add_argument("-n", "--name", default="animation", help="name of the array")
+    parser.add_argument("-b", "--binary", action="store_true", help="write the raw animation")
+    parser.add_argument("-o", "--output", help="output file (default stdout)")
+    args = parser.parse_args()
+
+    frames = []
+    for path in args.inputs:
+        frames += read_frames(path, args.width * args.height)
+
+    data = encode(frames, args.width, args.height, args.delay, args.keyframe_interval)
+
+    if args.binary:
+        out = open(args.output, "wb") if args.output else sys.stdout.buffer
+        out.write(data)
+    else:
+        out = open(args.output, "w") if args.output else sys.stdout
+        out.write(c_header(data, args.name, args.width, args.height, len(frames), args.inputs))
+
+    print("%d frames, %d bytes (%d raw)" % (len(frames), len(data), len(frames) * args.width * args.height * 2),
+          file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()